@@ -412,6 +412,25 @@ class BitsetBase {
             this->data(), this->offset(), this->size(), starting_bit_idx + 1);
     }
 
+    // Find the index of the first bit set to false.
+    inline std::optional<size_type>
+    find_first_unset() const {
+        return policy_type::op_find_unset(
+            this->data(), this->offset(), this->size(), 0);
+    }
+
+    // Find the index of the first bit set to false, starting from a given bit index.
+    inline std::optional<size_type>
+    find_next_unset(const size_type starting_bit_idx) const {
+        const size_type size_v = this->size();
+        if (starting_bit_idx + 1 >= size_v) {
+            return std::nullopt;
+        }
+
+        return policy_type::op_find_unset(
+            this->data(), this->offset(), this->size(), starting_bit_idx + 1);
+    }
+
     // Read multiple bits starting from a given bit index.
     inline data_type
     read(const size_type starting_bit_idx, const size_type nbits) {
@@ -502,6 +521,19 @@ class BitsetBase {
             this->data(), this->offset(), t, size, value);
     }
 
+    // OR the result of comparing elements of an given array with
+    //   a given value into the existing bits.
+    template <typename T, CompareOpType Op>
+    void
+    inplace_or_compare_val(const T* const __restrict t,
+                           const size_type size,
+                           const T& value) {
+        range_checker::le(size, this->size());
+
+        policy_type::template op_or_compare_val<T, Op>(
+            this->data(), this->offset(), t, size, value);
+    }
+
     //
     template <typename T>
     void
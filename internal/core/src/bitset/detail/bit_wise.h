@@ -292,6 +292,22 @@ struct BitWiseBitsetPolicy {
         return std::nullopt;
     }
 
+    //
+    static inline std::optional<size_type>
+    op_find_unset(const data_type* const data,
+                  const size_type start,
+                  const size_type size,
+                  const size_type starting_idx) {
+        for (size_type i = starting_idx; i < size; i++) {
+            const auto proxy = get_proxy(data, start + i);
+            if (!proxy) {
+                return i;
+            }
+        }
+
+        return std::nullopt;
+    }
+
     //
     template <typename T, typename U, CompareOpType Op>
     static inline void
@@ -320,6 +336,20 @@ struct BitWiseBitsetPolicy {
         }
     }
 
+    //
+    template <typename T, CompareOpType Op>
+    static inline void
+    op_or_compare_val(data_type* const __restrict data,
+                      const size_type start,
+                      const T* const __restrict t,
+                      const size_type size,
+                      const T& value) {
+        for (size_type i = 0; i < size; i++) {
+            get_proxy(data, start + i) |=
+                CompareOperator<Op>::compare(t[i], value);
+        }
+    }
+
     template <typename T, RangeType Op>
     static inline void
     op_within_range_column(data_type* const __restrict data,
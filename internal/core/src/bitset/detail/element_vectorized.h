@@ -193,6 +193,16 @@ struct VectorizedElementWiseBitsetPolicy {
             data, start, size, starting_idx);
     }
 
+    //
+    static inline std::optional<size_type>
+    op_find_unset(const data_type* const data,
+                  const size_type start,
+                  const size_type size,
+                  const size_type starting_idx) {
+        return ElementWiseBitsetPolicy<ElementT>::op_find_unset(
+            data, start, size, starting_idx);
+    }
+
     //
     template <typename T, typename U, CompareOpType Op>
     static inline void
@@ -254,6 +264,35 @@ struct VectorizedElementWiseBitsetPolicy {
             });
     }
 
+    //
+    template <typename T, CompareOpType Op>
+    static inline void
+    op_or_compare_val(data_type* const __restrict data,
+                      const size_type start,
+                      const T* const __restrict t,
+                      const size_type size,
+                      const T& value) {
+        op_func(
+            start,
+            size,
+            [data, t, value](const size_type starting_bit,
+                             const size_type ptr_offset,
+                             const size_type nbits) {
+                ElementWiseBitsetPolicy<ElementT>::template op_or_compare_val<
+                    T,
+                    Op>(data, starting_bit, t + ptr_offset, nbits, value);
+            },
+            [data, t, value](const size_type starting_element,
+                             const size_type ptr_offset,
+                             const size_type nbits) {
+                return VectorizedT::template op_or_compare_val<T, Op>(
+                    reinterpret_cast<uint8_t*>(data + starting_element),
+                    t + ptr_offset,
+                    nbits,
+                    value);
+            });
+    }
+
     //
     template <typename T, RangeType Op>
     static inline void
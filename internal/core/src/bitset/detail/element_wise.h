@@ -694,6 +694,34 @@ struct ElementWiseBitsetPolicy {
             const size_type start,
             const size_type size,
             const size_type starting_idx) {
+        return op_find_impl<true>(data, start, size, starting_idx);
+    }
+
+    //
+    static inline std::optional<size_type>
+    op_find_unset(const data_type* const data,
+                  const size_type start,
+                  const size_type size,
+                  const size_type starting_idx) {
+        return op_find_impl<false>(data, start, size, starting_idx);
+    }
+
+    // Scans whole elements and uses ctz on the first one that has a bit
+    // equal to IsSet. Elements are inverted when looking for unset bits.
+    template <bool IsSet>
+    static inline std::optional<size_type>
+    op_find_impl(const data_type* const data,
+                 const size_type start,
+                 const size_type size,
+                 const size_type starting_idx) {
+        auto load = [data](const size_type idx) -> data_type {
+            if constexpr (IsSet) {
+                return data[idx];
+            } else {
+                return ~data[idx];
+            }
+        };
+
         if (size == 0) {
             return std::nullopt;
         }
@@ -709,7 +737,7 @@ struct ElementWiseBitsetPolicy {
 
         // same element?
         if (start_element == end_element) {
-            const data_type existing_v = data[start_element];
+            const data_type existing_v = load(start_element);
 
             const data_type existing_mask = get_shift_mask_end(start_shift) &
                                             get_shift_mask_begin(end_shift);
@@ -725,7 +753,7 @@ struct ElementWiseBitsetPolicy {
 
         // process the first element
         if (start_shift != 0) {
-            const data_type existing_v = data[start_element];
+            const data_type existing_v = load(start_element);
             const data_type existing_mask = get_shift_mask_end(start_shift);
 
             const data_type value = existing_v & existing_mask;
@@ -741,7 +769,7 @@ struct ElementWiseBitsetPolicy {
 
         // process the middle
         for (size_type i = start_element; i < end_element; i++) {
-            const data_type value = data[i];
+            const data_type value = load(i);
             if (value != 0) {
                 const auto ctz = CtzHelper<data_type>::ctz(value);
                 return size_type(ctz) + i * data_bits - start;
@@ -750,7 +778,7 @@ struct ElementWiseBitsetPolicy {
 
         // process the last element
         if (end_shift != 0) {
-            const data_type existing_v = data[end_element];
+            const data_type existing_v = load(end_element);
             const data_type existing_mask = get_shift_mask_begin(end_shift);
 
             const data_type value = existing_v & existing_mask;
@@ -789,6 +817,19 @@ struct ElementWiseBitsetPolicy {
         });
     }
 
+    //
+    template <typename T, CompareOpType Op>
+    static inline void
+    op_or_compare_val(data_type* const __restrict data,
+                      const size_type start,
+                      const T* const __restrict t,
+                      const size_type size,
+                      const T& value) {
+        op_or_func(data, start, size, [t, value](const size_type bit_idx) {
+            return CompareOperator<Op>::compare(t[bit_idx], value);
+        });
+    }
+
     //
     template <typename T, RangeType Op>
     static inline void
@@ -978,6 +1019,26 @@ struct ElementWiseBitsetPolicy {
             const size_type start,
             const size_t size,
             Func func) {
+        op_func_impl<false>(data, start, size, func);
+    }
+
+    // bool Func(const size_type bit_idx);
+    // Same as op_func(), but ORs the produced bits into the existing ones.
+    template <typename Func>
+    static inline void
+    op_or_func(data_type* const __restrict data,
+               const size_type start,
+               const size_t size,
+               Func func) {
+        op_func_impl<true>(data, start, size, func);
+    }
+
+    template <bool OrWithExisting, typename Func>
+    static inline void
+    op_func_impl(data_type* const __restrict data,
+                 const size_type start,
+                 const size_t size,
+                 Func func) {
         if (size == 0) {
             return;
         }
@@ -999,6 +1060,10 @@ struct ElementWiseBitsetPolicy {
                 bits |= (data_type(bit ? 1 : 0) << j);
             }
 
+            if constexpr (OrWithExisting) {
+                bits |= op_read(data, start, size);
+            }
+
             op_write(data, start, size, bits);
             return;
         }
@@ -1016,6 +1081,10 @@ struct ElementWiseBitsetPolicy {
                 bits |= (data_type(bit ? 1 : 0) << j);
             }
 
+            if constexpr (OrWithExisting) {
+                bits |= op_read(data, start, n_bits);
+            }
+
             op_write(data, start, n_bits, bits);
 
             // start from the next element
@@ -1032,7 +1101,11 @@ struct ElementWiseBitsetPolicy {
                     bits |= (data_type(bit ? 1 : 0) << j);
                 }
 
-                data[i] = bits;
+                if constexpr (OrWithExisting) {
+                    data[i] |= bits;
+                } else {
+                    data[i] = bits;
+                }
                 ptr_offset += data_bits;
             }
         }
@@ -1046,6 +1119,10 @@ struct ElementWiseBitsetPolicy {
             }
 
             const size_t starting_bit_idx = end_element * data_bits;
+            if constexpr (OrWithExisting) {
+                bits |= op_read(data, starting_bit_idx, end_shift);
+            }
+
             op_write(data, starting_bit_idx, end_shift, bits);
         }
     }
@@ -99,6 +99,30 @@ ALL_DATATYPES_1(DECLARE_PARTIAL_OP_COMPARE_VAL)
 
 ///////////////////////////////////////////////////////////////////////////
 
+// the default implementation does nothing
+template <typename T, CompareOpType Op>
+struct OpOrCompareValImpl {
+    static inline bool
+    op_or_compare_val(uint8_t* const __restrict bitmask,
+                      const T* const __restrict t,
+                      const size_t size,
+                      const T& value) {
+        return false;
+    }
+};
+
+// only unsigned 64-bit values (timestamps) are handled
+template <CompareOpType Op>
+struct OpOrCompareValImpl<uint64_t, Op> {
+    static bool
+    op_or_compare_val(uint8_t* const __restrict bitmask,
+                      const uint64_t* const __restrict t,
+                      const size_t size,
+                      const uint64_t& value);
+};
+
+///////////////////////////////////////////////////////////////////////////
+
 // the default implementation does nothing
 template <typename T, RangeType Op>
 struct OpWithinRangeColumnImpl {
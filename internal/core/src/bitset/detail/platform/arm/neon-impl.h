@@ -177,6 +177,14 @@ struct CmpHelper<CompareOpType::EQ> {
                 vceqq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint64x2x4_t
+    compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vceqq_u64(a.val[0], b.val[0]),
+                vceqq_u64(a.val[1], b.val[1]),
+                vceqq_u64(a.val[2], b.val[2]),
+                vceqq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t
     compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vceqq_f32(a.val[0], b.val[0]), vceqq_f32(a.val[1], b.val[1])};
@@ -226,6 +234,14 @@ struct CmpHelper<CompareOpType::GE> {
                 vcgeq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint64x2x4_t
+    compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vcgeq_u64(a.val[0], b.val[0]),
+                vcgeq_u64(a.val[1], b.val[1]),
+                vcgeq_u64(a.val[2], b.val[2]),
+                vcgeq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t
     compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vcgeq_f32(a.val[0], b.val[0]), vcgeq_f32(a.val[1], b.val[1])};
@@ -275,6 +291,14 @@ struct CmpHelper<CompareOpType::GT> {
                 vcgtq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint64x2x4_t
+    compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vcgtq_u64(a.val[0], b.val[0]),
+                vcgtq_u64(a.val[1], b.val[1]),
+                vcgtq_u64(a.val[2], b.val[2]),
+                vcgtq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t
     compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vcgtq_f32(a.val[0], b.val[0]), vcgtq_f32(a.val[1], b.val[1])};
@@ -324,6 +348,14 @@ struct CmpHelper<CompareOpType::LE> {
                 vcleq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint64x2x4_t
+    compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vcleq_u64(a.val[0], b.val[0]),
+                vcleq_u64(a.val[1], b.val[1]),
+                vcleq_u64(a.val[2], b.val[2]),
+                vcleq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t
     compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vcleq_f32(a.val[0], b.val[0]), vcleq_f32(a.val[1], b.val[1])};
@@ -373,6 +405,14 @@ struct CmpHelper<CompareOpType::LT> {
                 vcltq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint64x2x4_t
+    compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vcltq_u64(a.val[0], b.val[0]),
+                vcltq_u64(a.val[1], b.val[1]),
+                vcltq_u64(a.val[2], b.val[2]),
+                vcltq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t
     compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vcltq_f32(a.val[0], b.val[0]), vcltq_f32(a.val[1], b.val[1])};
@@ -425,6 +465,14 @@ struct CmpHelper<CompareOpType::NE> {
                 vmvnq_u64(vceqq_s64(a.val[3], b.val[3]))};
     }
 
+    static inline uint64x2x4_t
+    compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vmvnq_u64(vceqq_u64(a.val[0], b.val[0])),
+                vmvnq_u64(vceqq_u64(a.val[1], b.val[1])),
+                vmvnq_u64(vceqq_u64(a.val[2], b.val[2])),
+                vmvnq_u64(vceqq_u64(a.val[3], b.val[3]))};
+    }
+
     static inline uint32x4x2_t
     compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vmvnq_u32(vceqq_f32(a.val[0], b.val[0])),
@@ -633,6 +681,40 @@ OpCompareValImpl<double, Op>::op_compare_val(uint8_t* const __restrict res_u8,
 
 ///////////////////////////////////////////////////////////////////////////
 
+//
+template <CompareOpType Op>
+bool
+OpOrCompareValImpl<uint64_t, Op>::op_or_compare_val(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict src,
+    const size_t size,
+    const uint64_t& val) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const uint64x2x4_t target = {
+        vdupq_n_u64(val), vdupq_n_u64(val), vdupq_n_u64(val), vdupq_n_u64(val)};
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const uint64x2x4_t v0 = {vld1q_u64(src + i),
+                                 vld1q_u64(src + i + 2),
+                                 vld1q_u64(src + i + 4),
+                                 vld1q_u64(src + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0, target);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] |= mmask;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
 //
 template <CompareOpType Op>
 bool
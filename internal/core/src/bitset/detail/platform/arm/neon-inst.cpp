@@ -103,6 +103,21 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, double)
 
 ///////////////////////////////////////////////////////////////////////////
 
+//
+#define INSTANTIATE_OR_COMPARE_VAL_NEON(TTYPE, OP)                   \
+    template bool                                                    \
+    OpOrCompareValImpl<TTYPE, CompareOpType::OP>::op_or_compare_val( \
+        uint8_t* const __restrict bitmask,                           \
+        const TTYPE* const __restrict src,                           \
+        const size_t size,                                           \
+        const TTYPE& val);
+
+ALL_COMPARE_OPS(INSTANTIATE_OR_COMPARE_VAL_NEON, uint64_t)
+
+#undef INSTANTIATE_OR_COMPARE_VAL_NEON
+
+///////////////////////////////////////////////////////////////////////////
+
 //
 #define INSTANTIATE_COMPARE_COLUMN_NEON(TTYPE, OP)                           \
     template bool                                                            \
@@ -44,6 +44,10 @@ struct VectorizedNeon {
     static constexpr inline auto op_compare_val =
         neon::OpCompareValImpl<T, Op>::op_compare_val;
 
+    template <typename T, CompareOpType Op>
+    static constexpr inline auto op_or_compare_val =
+        neon::OpOrCompareValImpl<T, Op>::op_or_compare_val;
+
     template <typename T, RangeType Op>
     static constexpr inline auto op_within_range_column =
         neon::OpWithinRangeColumnImpl<T, Op>::op_within_range_column;
@@ -187,6 +187,41 @@ ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, double)
 
 }  // namespace dynamic
 
+/////////////////////////////////////////////////////////////////////////////
+// op_or_compare_val
+template <typename T, CompareOpType Op>
+using OpOrCompareValPtr = bool (*)(uint8_t* const __restrict output,
+                                   const T* const __restrict t,
+                                   const size_t size,
+                                   const T& value);
+
+#define DECLARE_OP_OR_COMPARE_VAL(TTYPE, OP)               \
+    OpOrCompareValPtr<TTYPE, CompareOpType::OP>            \
+        op_or_compare_val_##TTYPE##_##OP = VectorizedRef:: \
+            template op_or_compare_val<TTYPE, CompareOpType::OP>;
+
+ALL_COMPARE_OPS(DECLARE_OP_OR_COMPARE_VAL, uint64_t)
+
+#undef DECLARE_OP_OR_COMPARE_VAL
+
+namespace dynamic {
+
+#define DISPATCH_OP_OR_COMPARE_VAL_IMPL(TTYPE, OP)                        \
+    template <>                                                           \
+    bool OpOrCompareValImpl<TTYPE, CompareOpType::OP>::op_or_compare_val( \
+        uint8_t* const __restrict bitmask,                                \
+        const TTYPE* const __restrict t,                                  \
+        const size_t size,                                                \
+        const TTYPE& value) {                                             \
+        return op_or_compare_val_##TTYPE##_##OP(bitmask, t, size, value); \
+    }
+
+ALL_COMPARE_OPS(DISPATCH_OP_OR_COMPARE_VAL_IMPL, uint64_t)
+
+#undef DISPATCH_OP_OR_COMPARE_VAL_IMPL
+
+}  // namespace dynamic
+
 /////////////////////////////////////////////////////////////////////////////
 // op_within_range column
 template <typename T, RangeType Op>
@@ -353,6 +388,9 @@ init_dynamic_hook() {
 #define SET_OP_COMPARE_VAL_AVX512(TTYPE, OP) \
     op_compare_val_##TTYPE##_##OP =          \
         VectorizedAvx512::template op_compare_val<TTYPE, CompareOpType::OP>;
+#define SET_OP_OR_COMPARE_VAL_AVX512(TTYPE, OP) \
+    op_or_compare_val_##TTYPE##_##OP =          \
+        VectorizedAvx512::template op_or_compare_val<TTYPE, CompareOpType::OP>;
 #define SET_OP_WITHIN_RANGE_COLUMN_AVX512(TTYPE, OP)             \
     op_within_range_column_##TTYPE##_##OP =                      \
         VectorizedAvx512::template op_within_range_column<TTYPE, \
@@ -381,6 +419,8 @@ init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, double)
 
+        ALL_COMPARE_OPS(SET_OP_OR_COMPARE_VAL_AVX512, uint64_t)
+
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, int8_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, int32_t)
@@ -404,6 +444,7 @@ init_dynamic_hook() {
 
 #undef SET_OP_COMPARE_COLUMN_AVX512
 #undef SET_OP_COMPARE_VAL_AVX512
+#undef SET_OP_OR_COMPARE_VAL_AVX512
 #undef SET_OP_WITHIN_RANGE_COLUMN_AVX512
 #undef SET_OP_WITHIN_RANGE_VAL_AVX512
 #undef SET_ARITH_COMPARE_AVX512
@@ -419,6 +460,9 @@ init_dynamic_hook() {
 #define SET_OP_COMPARE_VAL_AVX2(TTYPE, OP) \
     op_compare_val_##TTYPE##_##OP =        \
         VectorizedAvx2::template op_compare_val<TTYPE, CompareOpType::OP>;
+#define SET_OP_OR_COMPARE_VAL_AVX2(TTYPE, OP) \
+    op_or_compare_val_##TTYPE##_##OP =        \
+        VectorizedAvx2::template op_or_compare_val<TTYPE, CompareOpType::OP>;
 #define SET_OP_WITHIN_RANGE_COLUMN_AVX2(TTYPE, OP) \
     op_within_range_column_##TTYPE##_##OP =        \
         VectorizedAvx2::template op_within_range_column<TTYPE, RangeType::OP>;
@@ -446,6 +490,8 @@ init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, double)
 
+        ALL_COMPARE_OPS(SET_OP_OR_COMPARE_VAL_AVX2, uint64_t)
+
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, int8_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, int32_t)
@@ -469,6 +515,7 @@ init_dynamic_hook() {
 
 #undef SET_OP_COMPARE_COLUMN_AVX2
 #undef SET_OP_COMPARE_VAL_AVX2
+#undef SET_OP_OR_COMPARE_VAL_AVX2
 #undef SET_OP_WITHIN_RANGE_COLUMN_AVX2
 #undef SET_OP_WITHIN_RANGE_VAL_AVX2
 #undef SET_ARITH_COMPARE_AVX2
@@ -487,6 +534,9 @@ init_dynamic_hook() {
 #define SET_OP_COMPARE_VAL_SVE(TTYPE, OP) \
     op_compare_val_##TTYPE##_##OP =       \
         VectorizedSve::template op_compare_val<TTYPE, CompareOpType::OP>;
+#define SET_OP_OR_COMPARE_VAL_SVE(TTYPE, OP) \
+    op_or_compare_val_##TTYPE##_##OP =       \
+        VectorizedNeon::template op_or_compare_val<TTYPE, CompareOpType::OP>;
 #define SET_OP_WITHIN_RANGE_COLUMN_SVE(TTYPE, OP) \
     op_within_range_column_##TTYPE##_##OP =       \
         VectorizedSve::template op_within_range_column<TTYPE, RangeType::OP>;
@@ -514,6 +564,9 @@ init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, double)
 
+        // there is no SVE kernel for this one, NEON is always available
+        ALL_COMPARE_OPS(SET_OP_OR_COMPARE_VAL_SVE, uint64_t)
+
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, int8_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, int32_t)
@@ -537,6 +590,7 @@ init_dynamic_hook() {
 
 #undef SET_OP_COMPARE_COLUMN_SVE
 #undef SET_OP_COMPARE_VAL_SVE
+#undef SET_OP_OR_COMPARE_VAL_SVE
 #undef SET_OP_WITHIN_RANGE_COLUMN_SVE
 #undef SET_OP_WITHIN_RANGE_VAL_SVE
 #undef SET_ARITH_COMPARE_SVE
@@ -552,6 +606,9 @@ init_dynamic_hook() {
 #define SET_OP_COMPARE_VAL_NEON(TTYPE, OP) \
     op_compare_val_##TTYPE##_##OP =        \
         VectorizedNeon::template op_compare_val<TTYPE, CompareOpType::OP>;
+#define SET_OP_OR_COMPARE_VAL_NEON(TTYPE, OP) \
+    op_or_compare_val_##TTYPE##_##OP =        \
+        VectorizedNeon::template op_or_compare_val<TTYPE, CompareOpType::OP>;
 #define SET_OP_WITHIN_RANGE_COLUMN_NEON(TTYPE, OP) \
     op_within_range_column_##TTYPE##_##OP =        \
         VectorizedNeon::template op_within_range_column<TTYPE, RangeType::OP>;
@@ -579,6 +636,8 @@ init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, double)
 
+        ALL_COMPARE_OPS(SET_OP_OR_COMPARE_VAL_NEON, uint64_t)
+
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, int8_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, int32_t)
@@ -602,6 +661,7 @@ init_dynamic_hook() {
 
 #undef SET_OP_COMPARE_COLUMN_NEON
 #undef SET_OP_COMPARE_VAL_NEON
+#undef SET_OP_OR_COMPARE_VAL_NEON
 #undef SET_OP_WITHIN_RANGE_COLUMN_NEON
 #undef SET_OP_WITHIN_RANGE_VAL_NEON
 #undef SET_ARITH_COMPARE_NEON
@@ -91,6 +91,29 @@ ALL_DATATYPES_1(DECLARE_PARTIAL_OP_COMPARE_VAL)
 
 #undef DECLARE_PARTIAL_OP_COMPARE_VAL
 
+///////////////////////////////////////////////////////////////////////////
+// the default implementation
+template <typename T, CompareOpType Op>
+struct OpOrCompareValImpl {
+    static inline bool
+    op_or_compare_val(uint8_t* const __restrict bitmask,
+                      const T* const __restrict t,
+                      const size_t size,
+                      const T& value) {
+        return false;
+    }
+};
+
+// only unsigned 64-bit values (timestamps) are handled for now
+template <CompareOpType Op>
+struct OpOrCompareValImpl<uint64_t, Op> {
+    static bool
+    op_or_compare_val(uint8_t* const __restrict bitmask,
+                      const uint64_t* const __restrict t,
+                      const size_t size,
+                      const uint64_t& value);
+};
+
 ///////////////////////////////////////////////////////////////////////////
 // the default implementation
 template <typename T, RangeType Op>
@@ -213,6 +236,19 @@ struct VectorizedDynamic {
             bitmask, t, size, value);
     }
 
+    // Updates a bitmask by OR-ing the result of comparing elements of
+    //   a given array to a given value into the existing bits.
+    // API requirement: size % 8 == 0
+    template <typename T, CompareOpType Op>
+    static bool
+    op_or_compare_val(uint8_t* const __restrict bitmask,
+                      const T* const __restrict t,
+                      const size_t size,
+                      const T& value) {
+        return dynamic::OpOrCompareValImpl<T, Op>::op_or_compare_val(
+            bitmask, t, size, value);
+    }
+
     // API requirement: size % 8 == 0
     template <typename T, RangeType Op>
     static bool
@@ -56,6 +56,18 @@ struct VectorizedRef {
         return false;
     }
 
+    // Updates a bitmask by OR-ing the result of comparing elements of
+    //   a given array to a given value into the existing bits.
+    // API requirement: size % 8 == 0
+    template <typename T, CompareOpType Op>
+    static inline bool
+    op_or_compare_val(uint8_t* const __restrict output,
+                      const T* const __restrict t,
+                      const size_t size,
+                      const T& value) {
+        return false;
+    }
+
     // API requirement: size % 8 == 0
     template <typename T, RangeType Op>
     static inline bool
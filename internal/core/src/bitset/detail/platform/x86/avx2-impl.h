@@ -507,6 +507,44 @@ OpCompareValImpl<double, Op>::op_compare_val(uint8_t* const __restrict res_u8,
 
 ///////////////////////////////////////////////////////////////////////////
 
+//
+template <CompareOpType Op>
+bool
+OpOrCompareValImpl<uint64_t, Op>::op_or_compare_val(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict src,
+    const size_t size,
+    const uint64_t& val) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // AVX2 has no unsigned 64-bit comparison, so both operands are
+    //   moved to the signed domain by flipping their sign bits.
+    const __m256i sign = _mm256_set1_epi64x(int64_t(uint64_t(1) << 63));
+    const __m256i target =
+        _mm256_xor_si256(_mm256_set1_epi64x(int64_t(val)), sign);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0 = _mm256_xor_si256(
+            _mm256_loadu_si256((const __m256i*)(src + i)), sign);
+        const __m256i v1 = _mm256_xor_si256(
+            _mm256_loadu_si256((const __m256i*)(src + i + 4)), sign);
+        const __m256i cmp0 = CmpHelperI64<Op>::compare(v0, target);
+        const __m256i cmp1 = CmpHelperI64<Op>::compare(v1, target);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+        res_u8[i / 8] |= mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
 //
 template <CompareOpType Op>
 bool
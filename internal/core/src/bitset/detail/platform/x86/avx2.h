@@ -44,6 +44,10 @@ struct VectorizedAvx2 {
     static constexpr inline auto op_compare_val =
         avx2::OpCompareValImpl<T, Op>::op_compare_val;
 
+    template <typename T, CompareOpType Op>
+    static constexpr inline auto op_or_compare_val =
+        avx2::OpOrCompareValImpl<T, Op>::op_or_compare_val;
+
     template <typename T, RangeType Op>
     static constexpr inline auto op_within_range_column =
         avx2::OpWithinRangeColumnImpl<T, Op>::op_within_range_column;
@@ -397,6 +397,36 @@ OpCompareValImpl<double, Op>::op_compare_val(uint8_t* const __restrict res_u8,
 
 ///////////////////////////////////////////////////////////////////////////
 
+//
+template <CompareOpType Op>
+bool
+OpOrCompareValImpl<uint64_t, Op>::op_or_compare_val(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict src,
+    const size_t size,
+    const uint64_t& val) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const __m512i target = _mm512_set1_epi64(int64_t(val));
+    constexpr auto pred = ComparePredicate<uint64_t, Op>::value;
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512i v = _mm512_loadu_si512(src + i);
+        const __mmask8 cmp_mask = _mm512_cmp_epu64_mask(v, target, pred);
+
+        res_u8[i / 8] |= cmp_mask;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
 //
 template <CompareOpType Op>
 bool
@@ -102,6 +102,21 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, double)
 
 ///////////////////////////////////////////////////////////////////////////
 
+//
+#define INSTANTIATE_OR_COMPARE_VAL_AVX512(TTYPE, OP)                 \
+    template bool                                                    \
+    OpOrCompareValImpl<TTYPE, CompareOpType::OP>::op_or_compare_val( \
+        uint8_t* const __restrict bitmask,                           \
+        const TTYPE* const __restrict src,                           \
+        const size_t size,                                           \
+        const TTYPE& val);
+
+ALL_COMPARE_OPS(INSTANTIATE_OR_COMPARE_VAL_AVX512, uint64_t)
+
+#undef INSTANTIATE_OR_COMPARE_VAL_AVX512
+
+///////////////////////////////////////////////////////////////////////////
+
 //
 #define INSTANTIATE_COMPARE_COLUMN_AVX512(TTYPE, OP)                         \
     template bool                                                            \
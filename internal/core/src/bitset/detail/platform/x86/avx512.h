@@ -44,6 +44,10 @@ struct VectorizedAvx512 {
     static constexpr inline auto op_compare_val =
         avx512::OpCompareValImpl<T, Op>::op_compare_val;
 
+    template <typename T, CompareOpType Op>
+    static constexpr inline auto op_or_compare_val =
+        avx512::OpOrCompareValImpl<T, Op>::op_or_compare_val;
+
     template <typename T, RangeType Op>
     static constexpr inline auto op_within_range_column =
         avx512::OpWithinRangeColumnImpl<T, Op>::op_within_range_column;
@@ -28,6 +28,8 @@ int64_t LOW_PRIORITY_THREAD_CORE_COEFFICIENT =
     DEFAULT_LOW_PRIORITY_THREAD_CORE_COEFFICIENT;
 int CPU_NUM = DEFAULT_CPU_NUM;
 int64_t EXEC_EVAL_EXPR_BATCH_SIZE = DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE;
+int64_t EXEC_EVAL_EXPR_MAX_DRIVERS = DEFAULT_EXEC_EVAL_EXPR_MAX_DRIVERS;
+int64_t EXPR_RESULT_CACHE_SIZE = DEFAULT_EXPR_RESULT_CACHE_SIZE;
 
 void
 SetIndexSliceSize(const int64_t size) {
@@ -62,6 +64,19 @@ SetDefaultExecEvalExprBatchSize(int64_t val) {
     LOG_INFO("set default expr eval batch size: {}", EXEC_EVAL_EXPR_BATCH_SIZE);
 }
 
+void
+SetDefaultExecEvalExprMaxDrivers(int64_t val) {
+    EXEC_EVAL_EXPR_MAX_DRIVERS = val;
+    LOG_INFO("set default expr eval max drivers: {}",
+             EXEC_EVAL_EXPR_MAX_DRIVERS);
+}
+
+void
+SetDefaultExprResultCacheSize(int64_t val) {
+    EXPR_RESULT_CACHE_SIZE = val;
+    LOG_INFO("set default expr result cache size: {}", EXPR_RESULT_CACHE_SIZE);
+}
+
 void
 SetCpuNum(const int num) {
     CPU_NUM = num;
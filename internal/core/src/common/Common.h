@@ -27,6 +27,8 @@ extern int64_t MIDDLE_PRIORITY_THREAD_CORE_COEFFICIENT;
 extern int64_t LOW_PRIORITY_THREAD_CORE_COEFFICIENT;
 extern int CPU_NUM;
 extern int64_t EXEC_EVAL_EXPR_BATCH_SIZE;
+extern int64_t EXEC_EVAL_EXPR_MAX_DRIVERS;
+extern int64_t EXPR_RESULT_CACHE_SIZE;
 
 void
 SetIndexSliceSize(const int64_t size);
@@ -46,6 +48,12 @@ SetCpuNum(const int core);
 void
 SetDefaultExecEvalExprBatchSize(int64_t val);
 
+void
+SetDefaultExecEvalExprMaxDrivers(int64_t val);
+
+void
+SetDefaultExprResultCacheSize(int64_t val);
+
 struct BufferView {
     char* data_;
     size_t size_;
@@ -62,6 +62,20 @@ const int DEFAULT_CPU_NUM = 1;
 
 const int64_t DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE = 8192;
 
+const int64_t DEFAULT_EXEC_EVAL_EXPR_MAX_DRIVERS = 4;
+
+const int64_t DEFAULT_EXEC_EVAL_EXPR_MORSEL_BATCHES = 64;
+
+// shared by all sealed segments, 0 disables the expr result cache
+const int64_t DEFAULT_EXPR_RESULT_CACHE_SIZE = 0;
+
+// binlogs larger than this are decoded by ranged reads of their column
+// chunks, holding at most this many bytes of a binlog at a time
+const int64_t DEFAULT_RANGED_DECODE_WINDOW_SIZE = 16 << 20;  // bytes
+
+// smallest batch of queries a parallel search result reduce hands to a task
+const int64_t MIN_REDUCE_NQ_PER_TASK = 8;
+
 constexpr const char* RADIUS = knowhere::meta::RADIUS;
 constexpr const char* RANGE_FILTER = knowhere::meta::RANGE_FILTER;
 
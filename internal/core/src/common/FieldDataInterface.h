@@ -143,6 +143,15 @@ class FieldBitsetImpl : public FieldDataBase {
         Assert(cap_ >= length_);
     }
 
+    // wraps `length` bits at `data` without owning them, they must outlive
+    // this field data and it can't be reserved.
+    explicit FieldBitsetImpl(DataType data_type, Type* data, size_t length)
+        : FieldDataBase(data_type, false),
+          external_data_(data),
+          cap_(length),
+          length_(length) {
+    }
+
     // FillFieldData used for read and write with storage,
     // no need to implement for bitset which used in runtime process.
     void
@@ -190,7 +199,7 @@ class FieldBitsetImpl : public FieldDataBase {
 
     void*
     Data() override {
-        return data_.data();
+        return external_data_ != nullptr ? external_data_ : data_.data();
     }
 
     uint8_t*
@@ -247,6 +256,8 @@ class FieldBitsetImpl : public FieldDataBase {
         AssertInfo(cap % (8 * sizeof(Type)) == 0,
                    "Reverse bitset size must be a multiple of {}",
                    8 * sizeof(Type));
+        AssertInfo(external_data_ == nullptr || cap <= cap_,
+                   "can't reserve a bitset not owning its data");
         if (cap > cap_) {
             data_.resize(cap / (8 * sizeof(Type)));
             cap_ = cap;
@@ -285,6 +296,8 @@ class FieldBitsetImpl : public FieldDataBase {
 
  private:
     FixedVector<Type> data_{};
+    // the bits when not owned, data_ is empty then
+    Type* external_data_{nullptr};
     // capacity that data_ can store
     int64_t cap_;
     mutable std::shared_mutex cap_mutex_;
@@ -82,6 +82,13 @@ class ColumnVector final : public BaseVector {
                                                              std::move(bitmap));
     }
 
+    // wraps `size` bits at `data` without owning them, they must outlive
+    // the vector
+    ColumnVector(void* data, size_t size) : BaseVector(DataType::INT8, size) {
+        values_ = std::make_shared<FieldBitsetImpl<uint8_t>>(
+            DataType::INT8, static_cast<uint8_t*>(data), size);
+    }
+
     virtual ~ColumnVector() override {
         values_.reset();
     }
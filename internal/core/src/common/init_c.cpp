@@ -25,7 +25,7 @@
 #include "common/Tracer.h"
 #include "log/Log.h"
 
-std::once_flag flag1, flag2, flag3, flag4, flag5, flag6;
+std::once_flag flag1, flag2, flag3, flag4, flag5, flag6, flag7, flag8;
 std::once_flag traceFlag;
 
 void
@@ -78,6 +78,22 @@ InitDefaultExprEvalBatchSize(int64_t val) {
         val);
 }
 
+void
+InitDefaultExprEvalMaxDrivers(int64_t val) {
+    std::call_once(
+        flag7,
+        [](int64_t val) { milvus::SetDefaultExecEvalExprMaxDrivers(val); },
+        val);
+}
+
+void
+InitDefaultExprResultCacheSize(int64_t val) {
+    std::call_once(
+        flag8,
+        [](int64_t val) { milvus::SetDefaultExprResultCacheSize(val); },
+        val);
+}
+
 void
 InitTrace(CTraceConfig* config) {
     auto traceConfig = milvus::tracer::TraceConfig{config->exporter,
@@ -39,6 +39,12 @@ InitLowPriorityThreadCoreCoefficient(const int64_t);
 void
 InitDefaultExprEvalBatchSize(int64_t val);
 
+void
+InitDefaultExprEvalMaxDrivers(int64_t val);
+
+void
+InitDefaultExprResultCacheSize(int64_t val);
+
 void
 InitCpuNum(const int);
 
@@ -96,6 +96,8 @@ typedef struct CStorageConfig {
 
 typedef struct CMmapConfig {
     const char* cache_read_ahead_policy;
+    uint64_t cache_capacity;
+    const char* cache_eviction_policy;
     const char* mmap_path;
     uint64_t disk_limit;
     uint64_t fix_file_size;
@@ -119,6 +119,19 @@ class QueryConfig : public MemConfig {
     static constexpr const char* kExprEvalBatchSize =
         "expression.eval_batch_size";
 
+    // Max drivers to split one sealed segment's filter evaluation into.
+    static constexpr const char* kExprEvalMaxDrivers =
+        "expression.eval_max_drivers";
+
+    // Rows evaluated by a driver at a time, rounded to whole batches.
+    static constexpr const char* kExprEvalMorselSize =
+        "expression.eval_morsel_size";
+
+    // Whether and/or inputs are reordered by their observed cost and
+    // selectivity. True by default.
+    static constexpr const char* kExprEvalAdaptiveConjunct =
+        "expression.eval_adaptive_conjunct";
+
     QueryConfig(const std::unordered_map<std::string, std::string>& values)
         : MemConfig(values) {
     }
@@ -135,6 +148,26 @@ class QueryConfig : public MemConfig {
         return BaseConfig::Get<int64_t>(kExprEvalBatchSize,
                                         EXEC_EVAL_EXPR_BATCH_SIZE);
     }
+
+    int64_t
+    get_expr_max_drivers() const {
+        return BaseConfig::Get<int64_t>(kExprEvalMaxDrivers,
+                                        EXEC_EVAL_EXPR_MAX_DRIVERS);
+    }
+
+    int64_t
+    get_expr_morsel_size() const {
+        auto batch_size = get_expr_batch_size();
+        auto morsel_size = BaseConfig::Get<int64_t>(
+            kExprEvalMorselSize,
+            batch_size * DEFAULT_EXEC_EVAL_EXPR_MORSEL_BATCHES);
+        return std::max<int64_t>(1, morsel_size / batch_size) * batch_size;
+    }
+
+    bool
+    get_expr_adaptive_conjunct() const {
+        return BaseConfig::Get<bool>(kExprEvalAdaptiveConjunct, true);
+    }
 };
 
 class Context {
@@ -225,6 +258,32 @@ class QueryContext : public Context {
         return active_count_;
     }
 
+    // Evaluate only rows [row_offset, active_count) of the segment, the
+    // offset must be a multiple of the expr batch size.
+    void
+    set_row_offset(int64_t row_offset) {
+        row_offset_ = row_offset;
+    }
+
+    int64_t
+    get_row_offset() const {
+        return row_offset_;
+    }
+
+    // Preallocated, cleared bitset of all the active rows of the segment,
+    // exprs write the results of the batches straight into it where they
+    // can. The caller still has to copy the results that weren't written
+    // there.
+    void
+    set_output(TargetBitmap* output) {
+        output_ = output;
+    }
+
+    TargetBitmap*
+    get_output() const {
+        return output_;
+    }
+
  private:
     folly::Executor* executor_;
     //folly::Executor::KeepAlive<> executor_keepalive_;
@@ -236,6 +295,9 @@ class QueryContext : public Context {
     const milvus::segcore::SegmentInternalInterface* segment_;
     // num rows for current query
     int64_t active_count_;
+    // first row to evaluate, non-zero when running a morsel of the segment
+    int64_t row_offset_{0};
+    TargetBitmap* output_{nullptr};
     // timestamp this query generate
     milvus::Timestamp query_timestamp_;
 };
@@ -23,6 +23,8 @@ namespace exec {
 
 void
 PhyBinaryRangeFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
+    SetActiveRows(context);
+    SetOutput(context);
     switch (expr_->column_.data_type_) {
         case DataType::BOOL: {
             result = ExecRangeVisitorImpl<bool>();
@@ -240,8 +242,7 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForData() {
             PreCheckOverflow<T>(val1, val2, lower_inclusive, upper_inclusive)) {
         return res;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size));
+    auto res_vec = AllocateResult(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
 
     auto execute_sub_batch = [lower_inclusive, upper_inclusive](
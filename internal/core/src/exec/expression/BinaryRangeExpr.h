@@ -185,6 +185,13 @@ class PhyBinaryRangeFilterExpr : public SegmentExpr {
     void
     Eval(EvalCtx& context, VectorPtr& result) override;
 
+    void
+    MoveCursor() override {
+        SegmentExpr::MoveCursor();
+        overflow_check_pos_ +=
+            std::min(active_count_ - overflow_check_pos_, batch_size_);
+    }
+
  private:
     // Check overflow and cache result for performace
     template <
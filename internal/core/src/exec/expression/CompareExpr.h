@@ -134,14 +134,16 @@ class PhyCompareFilterExpr : public Expr {
             auto chunk_size = chunk_id == num_chunk_ - 1
                                   ? active_count_ - chunk_id * size_per_chunk_
                                   : size_per_chunk_;
+            auto data_pos =
+                chunk_id == current_chunk_id_ ? current_chunk_pos_ : 0;
+            auto size =
+                std::min(chunk_size - data_pos, batch_size_ - processed_rows);
 
-            for (int i = chunk_id == current_chunk_id_ ? current_chunk_pos_ : 0;
-                 i < chunk_size;
-                 ++i) {
-                if (++processed_rows >= batch_size_) {
-                    current_chunk_id_ = chunk_id;
-                    current_chunk_pos_ = i + 1;
-                }
+            processed_rows += size;
+            current_chunk_id_ = chunk_id;
+            current_chunk_pos_ = data_pos + size;
+            if (processed_rows >= batch_size_) {
+                break;
             }
         }
     }
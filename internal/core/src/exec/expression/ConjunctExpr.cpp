@@ -16,6 +16,10 @@
 
 #include "ConjunctExpr.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
 namespace milvus {
 namespace exec {
 
@@ -83,33 +87,128 @@ PhyConjunctFilterExpr::CanSkipFollowingExprs(ColumnVectorPtr& vec) {
 
 void
 PhyConjunctFilterExpr::SkipFollowingExprs(int start) {
-    for (int i = start; i < inputs_.size(); ++i) {
-        inputs_[i]->MoveCursor();
+    for (int i = start; i < input_order_.size(); ++i) {
+        inputs_[input_order_[i]]->MoveCursor();
     }
 }
 
+void
+PhyConjunctFilterExpr::InitInputOrder() {
+    std::stable_partition(
+        input_order_.begin(), input_order_.end(), [this](int32_t input) {
+            auto segment_expr =
+                dynamic_cast<const SegmentExpr*>(inputs_[input].get());
+            return segment_expr != nullptr && segment_expr->IsIndexMode();
+        });
+}
+
+void
+PhyConjunctFilterExpr::ReorderInputs() {
+    // nanoseconds spent per decided row, inputs that decide no row rank by
+    // their cost alone
+    auto rank = [this](int32_t input) {
+        const auto& stats = input_stats_[input];
+        if (stats.rows == 0) {
+            return std::numeric_limits<double>::max();
+        }
+        return stats.nanos / (stats.decided_rows + 1);
+    };
+    std::stable_sort(input_order_.begin(),
+                     input_order_.end(),
+                     [&](int32_t a, int32_t b) { return rank(a) < rank(b); });
+}
+
+int64_t
+PhyConjunctFilterExpr::UpdateActiveRows(ColumnVectorPtr& result,
+                                        const TargetBitmap* parent_active_rows,
+                                        TargetBitmap& active_rows) {
+    TargetBitmapView res_data(result->GetRawData(), result->size());
+    active_rows.clear();
+    active_rows.append(res_data);
+    // an and is undecided where it is still true, an or where it is false
+    if (!is_and_) {
+        active_rows.flip();
+    }
+    if (parent_active_rows != nullptr &&
+        parent_active_rows->size() == active_rows.size()) {
+        active_rows.inplace_and(*parent_active_rows, active_rows.size());
+    }
+    return int64_t(active_rows.count());
+}
+
 void
 PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
-    for (int i = 0; i < inputs_.size(); ++i) {
+    auto adaptive = context.get_exec_context() != nullptr &&
+                    context.get_query_config()->get_expr_adaptive_conjunct();
+    if (adaptive && !input_order_inited_) {
+        InitInputOrder();
+        input_order_inited_ = true;
+    }
+
+    // the following inputs are only evaluated for the rows the ones before
+    // them left undecided.
+    auto parent_active_rows = context.get_active_rows();
+    TargetBitmap active_rows;
+    int64_t undecided_rows = -1;
+    for (int i = 0; i < input_order_.size(); ++i) {
+        auto input = input_order_[i];
+        auto start = std::chrono::steady_clock::now();
         VectorPtr input_result;
-        inputs_[i]->Eval(context, input_result);
+        inputs_[input]->Eval(context, input_result);
+        auto nanos = std::chrono::duration<double, std::nano>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+        bool decided = false;
         if (i == 0) {
-            result = input_result;
-            auto all_flat_result = GetColumnVector(result);
-            if (CanSkipFollowingExprs(all_flat_result)) {
-                SkipFollowingExprs(i + 1);
-                return;
+            // the result of the first input becomes ours, the other inputs
+            // must not write theirs to the output
+            context.TakeOutput();
+            // the following inputs are combined into the result in place,
+            // copy it if the input keeps it for later batches.
+            if (input_result.use_count() > 1 && input_order_.size() > 1) {
+                auto input_flat_result = GetColumnVector(input_result);
+                TargetBitmap res;
+                res.append(TargetBitmapView(input_flat_result->GetRawData(),
+                                            input_flat_result->size()));
+                result = std::make_shared<ColumnVector>(std::move(res));
+            } else {
+                result = input_result;
             }
-            continue;
+            auto all_flat_result = GetColumnVector(result);
+            decided = CanSkipFollowingExprs(all_flat_result);
+            undecided_rows = parent_active_rows != nullptr
+                                 ? int64_t(parent_active_rows->count())
+                                 : int64_t(all_flat_result->size());
+        } else {
+            auto input_flat_result = GetColumnVector(input_result);
+            auto all_flat_result = GetColumnVector(result);
+            decided =
+                UpdateResult(input_flat_result, context, all_flat_result) == 0;
         }
-        auto input_flat_result = GetColumnVector(input_result);
+
         auto all_flat_result = GetColumnVector(result);
-        auto active_rows =
-            UpdateResult(input_flat_result, context, all_flat_result);
-        if (active_rows == 0) {
+        auto remaining_rows = UpdateActiveRows(
+            all_flat_result, parent_active_rows, active_rows);
+        auto& stats = input_stats_[input];
+        stats.rows = stats.rows * kInputStatsDecay + undecided_rows;
+        auto decided_rows =
+            std::max<int64_t>(0, undecided_rows - remaining_rows);
+        stats.decided_rows =
+            stats.decided_rows * kInputStatsDecay + decided_rows;
+        stats.nanos = stats.nanos * kInputStatsDecay + nanos;
+        undecided_rows = remaining_rows;
+
+        if (decided) {
             SkipFollowingExprs(i + 1);
-            return;
+            break;
         }
+        context.set_active_rows(&active_rows);
+    }
+    context.set_active_rows(parent_active_rows);
+
+    if (adaptive) {
+        ReorderInputs();
     }
 }
 
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <numeric>
+
 #include <fmt/core.h>
 
 #include "common/EasyAssert.h"
@@ -77,6 +79,10 @@ class PhyConjunctFilterExpr : public Expr {
                        [](const ExprPtr& expr) { return expr->type(); });
 
         ResolveType(input_types);
+
+        input_order_.resize(inputs_.size());
+        std::iota(input_order_.begin(), input_order_.end(), 0);
+        input_stats_.resize(inputs_.size());
     }
 
     void
@@ -89,6 +95,12 @@ class PhyConjunctFilterExpr : public Expr {
         }
     }
 
+    // inputs_ indexes in the order the next batch evaluates them
+    const std::vector<int32_t>&
+    input_order() const {
+        return input_order_;
+    }
+
  private:
     int64_t
     UpdateResult(ColumnVectorPtr& input_result,
@@ -103,9 +115,40 @@ class PhyConjunctFilterExpr : public Expr {
 
     void
     SkipFollowingExprs(int start);
+
+    // rows whose outcome `result` doesn't decide yet, restricted to the
+    // rows the enclosing expr needs. Returns their count.
+    int64_t
+    UpdateActiveRows(ColumnVectorPtr& result,
+                     const TargetBitmap* parent_active_rows,
+                     TargetBitmap& active_rows);
+
+    // moves index backed inputs to the front, before any cost is known.
+    void
+    InitInputOrder();
+
+    // orders the inputs by the time they spent per row they decided.
+    void
+    ReorderInputs();
+
+    // cost of an input over the recent batches, older batches weigh less.
+    struct InputStats {
+        // rows the input was evaluated for
+        double rows{0};
+        // rows it decided: turned false for and, true for or
+        double decided_rows{0};
+        double nanos{0};
+    };
+
+    // weight of the stats of the previous batches against the current one
+    static constexpr double kInputStatsDecay = 0.75;
+
     // true if conjunction (and), false if disjunction (or).
     bool is_and_;
+    // inputs_ indexes in evaluation order
     std::vector<int32_t> input_order_;
+    bool input_order_inited_{false};
+    std::vector<InputStats> input_stats_;
 };
 }  //namespace exec
 }  // namespace milvus
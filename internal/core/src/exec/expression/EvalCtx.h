@@ -18,6 +18,7 @@
 
 #include <cassert>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -51,11 +52,41 @@ class EvalCtx {
         return exec_ctx_->get_query_config();
     }
 
+    // rows of the current batch whose result is still needed by the
+    // enclosing conjunction, nullptr if all of them are. An expr may leave
+    // any value in the result of the other rows.
+    const TargetBitmap*
+    get_active_rows() const {
+        return active_rows_;
+    }
+
+    void
+    set_active_rows(const TargetBitmap* active_rows) {
+        active_rows_ = active_rows;
+    }
+
+    // the slice of the caller's bitset the result of the current batch ends
+    // up in. The first expr allocating a result for the batch may take it and
+    // write its result there, the caller then skips copying the batch.
+    std::optional<TargetBitmapView>
+    TakeOutput() {
+        auto output = output_;
+        output_.reset();
+        return output;
+    }
+
+    void
+    set_output(TargetBitmapView output) {
+        output_ = output;
+    }
+
  private:
     ExecContext* exec_ctx_;
     ExprSet* expr_set_;
     RowVector* row_;
     bool input_no_nulls_;
+    const TargetBitmap* active_rows_{nullptr};
+    std::optional<TargetBitmapView> output_;
 };
 
 }  // namespace exec
@@ -22,6 +22,7 @@ namespace exec {
 
 void
 PhyExistsFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
+    SetActiveRows(context);
     switch (expr_->column_.data_type_) {
         case DataType::JSON: {
             if (is_index_mode_) {
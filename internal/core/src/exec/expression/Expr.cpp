@@ -255,6 +255,76 @@ CompileExpression(const expr::TypedExprPtr& expr,
     return result;
 }
 
+bool
+SupportMorselExecution(const expr::TypedExprPtr& expr,
+                       const segcore::SegmentInternalInterface& segment) {
+    if (segment.type() != SegmentType::Sealed) {
+        return false;
+    }
+    // index results are computed for the whole chunk at once
+    auto scans_data = [&](const expr::ColumnInfo& column) {
+        return !segment.HasIndex(column.field_id_);
+    };
+    // json index lookups build their result bitmap for the whole segment
+    auto has_json_index = [&](const expr::ColumnInfo& column) {
+        return column.data_type_ == DataType::JSON &&
+               segment.GetJsonIndex(
+                   column.field_id_,
+                   milvus::Json::pointer(column.nested_path_)) != nullptr;
+    };
+
+    if (std::dynamic_pointer_cast<const expr::LogicalBinaryExpr>(expr) ||
+        std::dynamic_pointer_cast<const expr::LogicalUnaryExpr>(expr) ||
+        std::dynamic_pointer_cast<const expr::AlwaysTrueExpr>(expr)) {
+        for (auto& input : expr->inputs()) {
+            if (!SupportMorselExecution(input, segment)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::UnaryRangeFilterExpr>(
+                expr)) {
+        return scans_data(casted_expr->column_) &&
+               !has_json_index(casted_expr->column_);
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::TermFilterExpr>(expr)) {
+        // pk term filters look up the pk index for the whole segment
+        auto& column = casted_expr->column_;
+        auto pk_field_id = segment.get_schema().get_primary_field_id();
+        auto is_pk = pk_field_id.has_value() &&
+                     pk_field_id.value() == column.field_id_ &&
+                     IsPrimaryKeyDataType(column.data_type_);
+        return !is_pk && scans_data(column) && !has_json_index(column);
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::BinaryRangeFilterExpr>(
+                expr)) {
+        return scans_data(casted_expr->column_);
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::BinaryArithOpEvalRangeExpr>(
+                expr)) {
+        return scans_data(casted_expr->column_);
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::ExistsExpr>(expr)) {
+        return scans_data(casted_expr->column_);
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::JsonContainsExpr>(expr)) {
+        return scans_data(casted_expr->column_);
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::CompareExpr>(expr)) {
+        return !segment.HasIndex(casted_expr->left_field_id_) &&
+               !segment.HasIndex(casted_expr->right_field_id_);
+    }
+    return false;
+}
+
 inline void
 OptimizeCompiledExprs(ExecContext* context, const std::vector<ExprPtr>& exprs) {
     // For pk in [...] can use cache to accelate, but not for other exprs like expr1 && pk in [...]
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "common/Types.h"
@@ -189,6 +190,68 @@ class SegmentExpr : public Expr {
                    : batch_size_;
     }
 
+    // remembers the rows of the coming batch the enclosing conjunction
+    // still needs, ProcessDataChunks only evaluates those when they are
+    // sparse enough.
+    void
+    SetActiveRows(EvalCtx& context) {
+        active_rows_ = context.get_active_rows();
+    }
+
+    // takes the output slice of the coming batch for AllocateResult, only
+    // for exprs whose results are never kept across batches.
+    void
+    SetOutput(EvalCtx& context) {
+        output_ = context.TakeOutput();
+    }
+
+    // a cleared result of a batch of `size` rows. It wraps the output slice
+    // taken by SetOutput if that one fits, the batch is then written straight
+    // into the caller's bitset.
+    ColumnVectorPtr
+    AllocateResult(int64_t size) {
+        if (output_.has_value() && int64_t(output_->size()) == size) {
+            auto res = std::make_shared<ColumnVector>(output_->data(), size);
+            output_.reset();
+            return res;
+        }
+        return std::make_shared<ColumnVector>(TargetBitmap(size));
+    }
+
+    // the active rows if the batch should be evaluated row range by row
+    // range, nullptr if evaluating the whole batch is cheaper.
+    const TargetBitmap*
+    SparseActiveRows(int64_t batch_size) const {
+        if (active_rows_ == nullptr ||
+            int64_t(active_rows_->size()) != batch_size) {
+            return nullptr;
+        }
+        auto active_count = int64_t(active_rows_->count());
+        return active_count * kDenseActiveRowsRatio < batch_size ? active_rows_
+                                                                 : nullptr;
+    }
+
+    // calls func(begin, size) for every run of active rows within
+    // [offset, offset + size) of the batch, begin is relative to offset.
+    template <typename RunFunc>
+    static void
+    ForEachActiveRun(const TargetBitmap& active_rows,
+                     int64_t offset,
+                     int64_t size,
+                     RunFunc func) {
+        auto rows = active_rows.view(offset, size);
+        auto begin = rows.find_first();
+        while (begin.has_value()) {
+            auto end = rows.find_next_unset(begin.value());
+            auto run_end = end.has_value() ? int64_t(end.value()) : size;
+            func(int64_t(begin.value()), run_end - int64_t(begin.value()));
+            if (!end.has_value()) {
+                break;
+            }
+            begin = rows.find_next(end.value());
+        }
+    }
+
     // used for processing raw data expr for sealed segments.
     // now only used for std::string_view && json
     // TODO: support more types
@@ -212,7 +275,16 @@ class SegmentExpr : public Expr {
                         field_id_, 0, current_data_chunk_pos_, need_size)
                     .first;
 
-            func(data_vec.data(), need_size, res, values...);
+            auto active_rows = SparseActiveRows(need_size);
+            if (active_rows == nullptr) {
+                func(data_vec.data(), need_size, res, values...);
+            } else {
+                ForEachActiveRun(
+                    *active_rows, 0, need_size, [&](int64_t begin, int64_t n) {
+                        func(
+                            data_vec.data() + begin, n, res + begin, values...);
+                    });
+            }
         }
         current_data_chunk_pos_ += need_size;
         return need_size;
@@ -235,6 +307,7 @@ class SegmentExpr : public Expr {
             }
         }
 
+        auto active_rows = SparseActiveRows(res.size());
         for (size_t i = current_data_chunk_; i < num_data_chunk_; i++) {
             auto data_pos =
                 (i == current_data_chunk_) ? current_data_chunk_pos_ : 0;
@@ -253,7 +326,19 @@ class SegmentExpr : public Expr {
             if (!skip_func || !skip_func(skip_index, field_id_, i)) {
                 auto chunk = segment_->chunk_data<T>(field_id_, i);
                 const T* data = chunk.data() + data_pos;
-                func(data, size, res + processed_size, values...);
+                if (active_rows == nullptr) {
+                    func(data, size, res + processed_size, values...);
+                } else {
+                    ForEachActiveRun(*active_rows,
+                                     processed_size,
+                                     size,
+                                     [&](int64_t begin, int64_t n) {
+                                         func(data + begin,
+                                              n,
+                                              res + processed_size + begin,
+                                              values...);
+                                     });
+                }
             }
 
             processed_size += size;
@@ -372,6 +457,46 @@ class SegmentExpr : public Expr {
         use_index_ = false;
     }
 
+    // whether batches are answered from a scalar index, which is far
+    // cheaper per batch than scanning raw data.
+    bool
+    IsIndexMode() const {
+        return is_index_mode_ && use_index_;
+    }
+
+    // index on the values at `pointer` of the json field, numbers are
+    // indexed as double. nullptr if the segment has no such index.
+    template <typename T>
+    index::ScalarIndex<T>*
+    GetJsonIndex(const std::string& pointer) const {
+        if (segment_->type() != SegmentType::Sealed) {
+            return nullptr;
+        }
+        auto index = dynamic_cast<const index::ScalarIndex<T>*>(
+            segment_->GetJsonIndex(field_id_, pointer));
+        return const_cast<index::ScalarIndex<T>*>(index);
+    }
+
+    // evaluates `func` on a json index once for the whole segment, and
+    // returns the rows of the current batch like ProcessDataChunks would.
+    template <typename FUNC>
+    VectorPtr
+    ProcessJsonIndex(FUNC func) {
+        auto real_batch_size = GetNextBatchSize();
+        if (real_batch_size == 0) {
+            return nullptr;
+        }
+        if (!cached_json_index_res_.has_value()) {
+            cached_json_index_res_ = func();
+        }
+        TargetBitmap res;
+        res.append(cached_json_index_res_.value(),
+                   current_data_chunk_pos_,
+                   real_batch_size);
+        current_data_chunk_pos_ += real_batch_size;
+        return std::make_shared<ColumnVector>(std::move(res));
+    }
+
  protected:
     const segcore::SegmentInternalInterface* segment_;
     const FieldId field_id_;
@@ -399,6 +524,16 @@ class SegmentExpr : public Expr {
     // Cache for index scan to avoid search index every batch
     int64_t cached_index_chunk_id_{-1};
     TargetBitmap cached_index_chunk_res_{};
+    // result of a json index for the whole segment
+    std::optional<TargetBitmap> cached_json_index_res_{};
+
+    // below one active row in kDenseActiveRowsRatio, data is evaluated
+    // only for the active rows instead of for the whole batch.
+    static constexpr int64_t kDenseActiveRowsRatio = 4;
+    // rows of the current batch still needed by the enclosing conjunction
+    const TargetBitmap* active_rows_{nullptr};
+    // where the result of the coming batch ends up, see SetOutput
+    std::optional<TargetBitmapView> output_;
 };
 
 void
@@ -422,6 +557,13 @@ CompileExpression(const expr::TypedExprPtr& expr,
                   const std::unordered_set<std::string>& flatten_cadidates,
                   bool enable_constant_folding);
 
+// Whether the compiled `expr` only reads rows under its own cursor on
+// `segment`, so that the segment can be split into row ranges evaluated by
+// separate drivers. Decided from the logical tree, without compiling it.
+bool
+SupportMorselExecution(const expr::TypedExprPtr& expr,
+                       const segcore::SegmentInternalInterface& segment);
+
 class ExprSet {
  public:
     explicit ExprSet(const std::vector<expr::TypedExprPtr>& logical_exprs,
@@ -21,6 +21,8 @@ namespace exec {
 
 void
 PhyTermFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
+    SetActiveRows(context);
+    SetOutput(context);
     if (is_pk_field_) {
         result = ExecPkTermImpl();
         return;
@@ -125,6 +127,26 @@ PhyTermFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
     }
 }
 
+template <typename T>
+const TermSet<T>&
+PhyTermFilterExpr::GetTermSet() {
+    if (term_set_ == nullptr) {
+        std::vector<T> vals;
+        vals.reserve(expr_->vals_.size());
+        for (const auto& val : expr_->vals_) {
+            // values out of the range of T match no row
+            bool overflowed = false;
+            auto converted_val =
+                GetValueFromProtoWithOverflow<T>(val, overflowed);
+            if (!overflowed) {
+                vals.emplace_back(std::move(converted_val));
+            }
+        }
+        term_set_ = std::make_shared<TermSet<T>>(std::move(vals));
+    }
+    return *std::static_pointer_cast<const TermSet<T>>(term_set_);
+}
+
 template <typename T>
 bool
 PhyTermFilterExpr::CanSkipSegment() {
@@ -305,13 +327,10 @@ PhyTermFilterExpr::ExecTermArrayFieldInVariable() {
     if (expr_->column_.nested_path_.size() > 0) {
         index = std::stoi(expr_->column_.nested_path_[0]);
     }
-    std::unordered_set<ValueType> term_set;
-    for (const auto& element : expr_->vals_) {
-        term_set.insert(GetValueFromProto<ValueType>(element));
-    }
-
+    const auto& term_set = GetTermSet<ValueType>();
     if (term_set.empty()) {
         res.reset();
+        MoveCursor();
         return res_vec;
     }
 
@@ -319,24 +338,19 @@ PhyTermFilterExpr::ExecTermArrayFieldInVariable() {
                                 const int size,
                                 TargetBitmapView res,
                                 int index,
-                                const std::unordered_set<ValueType>& term_set) {
-        if (term_set.empty()) {
-            for (int i = 0; i < size; ++i) {
-                res[i] = false;
-            }
-        }
+                                const TermSet<ValueType>* term_set) {
         for (int i = 0; i < size; ++i) {
             if (index >= data[i].length()) {
                 res[i] = false;
                 continue;
             }
             auto value = data[i].get_data<GetType>(index);
-            res[i] = term_set.find(ValueType(value)) != term_set.end();
+            res[i] = term_set->Contains(value);
         }
     };
 
     int64_t processed_size = ProcessDataChunks<milvus::ArrayView>(
-        execute_sub_batch, std::nullptr_t{}, res, index, term_set);
+        execute_sub_batch, std::nullptr_t{}, res, index, &term_set);
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
                "expect batch size {}",
@@ -400,12 +414,47 @@ PhyTermFilterExpr::ExecTermJsonVariableInField() {
     return res_vec;
 }
 
+template <typename ValueType>
+VectorPtr
+PhyTermFilterExpr::ExecTermJsonFieldInVariableForIndex() {
+    using IndexInnerType = JsonIndexValueType<ValueType>;
+    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    auto execute = [&]() -> TargetBitmap {
+        auto index = GetJsonIndex<IndexInnerType>(pointer);
+        AssertInfo(
+            index != nullptr, "json index of path {} not found", pointer);
+        std::vector<IndexInnerType> vals;
+        vals.reserve(expr_->vals_.size());
+        for (const auto& element : expr_->vals_) {
+            vals.emplace_back(
+                IndexInnerType(GetValueFromProto<ValueType>(element)));
+        }
+        return index->In(vals.size(), vals.data());
+    };
+    return ProcessJsonIndex(execute);
+}
+
 template <typename ValueType>
 VectorPtr
 PhyTermFilterExpr::ExecTermJsonFieldInVariable() {
     using GetType = std::conditional_t<std::is_same_v<ValueType, std::string>,
                                        std::string_view,
                                        ValueType>;
+    if (cached_json_index_res_.has_value()) {
+        return ExecTermJsonFieldInVariableForIndex<ValueType>();
+    }
+    if (!expr_->vals_.empty()) {
+        auto use_index = std::all_of(
+            expr_->vals_.begin(), expr_->vals_.end(), [](const auto& val) {
+                return IsExactInJsonIndex(GetValueFromProto<ValueType>(val));
+            });
+        auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+        if (use_index &&
+            GetJsonIndex<JsonIndexValueType<ValueType>>(pointer) != nullptr) {
+            return ExecTermJsonFieldInVariableForIndex<ValueType>();
+        }
+    }
+
     auto real_batch_size = GetNextBatchSize();
     if (real_batch_size == 0) {
         return nullptr;
@@ -416,15 +465,10 @@ PhyTermFilterExpr::ExecTermJsonFieldInVariable() {
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
 
     auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
-    std::unordered_set<ValueType> term_set;
-    for (const auto& element : expr_->vals_) {
-        term_set.insert(GetValueFromProto<ValueType>(element));
-    }
-
+    const auto& term_set = GetTermSet<ValueType>();
     if (term_set.empty()) {
-        for (size_t i = 0; i < real_batch_size; ++i) {
-            res[i] = false;
-        }
+        res.reset();
+        MoveCursor();
         return res_vec;
     }
 
@@ -432,7 +476,7 @@ PhyTermFilterExpr::ExecTermJsonFieldInVariable() {
                                 const int size,
                                 TargetBitmapView res,
                                 const std::string pointer,
-                                const std::unordered_set<ValueType>& terms) {
+                                const TermSet<ValueType>* terms) {
         auto executor = [&](size_t i) {
             auto x = data[i].template at<GetType>(pointer);
             if (x.error()) {
@@ -445,18 +489,18 @@ PhyTermFilterExpr::ExecTermJsonFieldInVariable() {
                     auto value = x.value();
                     // if the term set is {1}, and the value is 1.1, we should not return true.
                     return std::floor(value) == value &&
-                           terms.find(ValueType(value)) != terms.end();
+                           terms->Contains(ValueType(value));
                 }
                 return false;
             }
-            return terms.find(ValueType(x.value())) != terms.end();
+            return terms->Contains(x.value());
         };
         for (size_t i = 0; i < size; ++i) {
             res[i] = executor(i);
         }
     };
     int64_t processed_size = ProcessDataChunks<milvus::Json>(
-        execute_sub_batch, std::nullptr_t{}, res, pointer, term_set);
+        execute_sub_batch, std::nullptr_t{}, res, pointer, &term_set);
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
                "expect batch size {}",
@@ -542,31 +586,26 @@ PhyTermFilterExpr::ExecVisitorImplForData() {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size));
+    auto res_vec = AllocateResult(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
 
-    std::vector<T> vals;
-    for (auto& val : expr_->vals_) {
-        // Integral overflow process
-        bool overflowed = false;
-        auto converted_val = GetValueFromProtoWithOverflow<T>(val, overflowed);
-        if (!overflowed) {
-            vals.emplace_back(converted_val);
-        }
-    }
-    std::unordered_set<T> vals_set(vals.begin(), vals.end());
+    using SetType = std::
+        conditional_t<std::is_same_v<T, std::string_view>, std::string, T>;
+    const auto& term_set = GetTermSet<SetType>();
     auto execute_sub_batch = [](const T* data,
                                 const int size,
                                 TargetBitmapView res,
-                                const std::unordered_set<T>& vals) {
-        TermElementFuncSet<T> func;
-        for (size_t i = 0; i < size; ++i) {
-            res[i] = func(vals, data[i]);
+                                const TermSet<SetType>* term_set) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            term_set->BatchContains(data, size, res);
+        } else {
+            for (size_t i = 0; i < size; ++i) {
+                res[i] = term_set->Contains(data[i]);
+            }
         }
     };
     int64_t processed_size = ProcessDataChunks<T>(
-        execute_sub_batch, std::nullptr_t{}, res, vals_set);
+        execute_sub_batch, std::nullptr_t{}, res, &term_set);
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
                "expect batch size {}",
@@ -22,19 +22,12 @@
 #include "common/Types.h"
 #include "common/Vector.h"
 #include "exec/expression/Expr.h"
+#include "exec/expression/TermSet.h"
 #include "segcore/SegmentInterface.h"
 
 namespace milvus {
 namespace exec {
 
-template <typename T>
-struct TermElementFuncSet {
-    bool
-    operator()(const std::unordered_set<T>& srcs, T val) {
-        return srcs.find(val) != srcs.end();
-    }
-};
-
 template <typename T>
 struct TermIndexFunc {
     typedef std::
@@ -83,6 +76,11 @@ class PhyTermFilterExpr : public SegmentExpr {
     bool
     CanSkipSegment();
 
+    // values of the expr that fit in T, built on the first call.
+    template <typename T>
+    const TermSet<T>&
+    GetTermSet();
+
     VectorPtr
     ExecPkTermImpl();
 
@@ -110,6 +108,10 @@ class PhyTermFilterExpr : public SegmentExpr {
     VectorPtr
     ExecTermJsonFieldInVariable();
 
+    template <typename ValueType>
+    VectorPtr
+    ExecTermJsonFieldInVariableForIndex();
+
     template <typename ValueType>
     VectorPtr
     ExecVisitorImplTemplateArray();
@@ -130,6 +132,8 @@ class PhyTermFilterExpr : public SegmentExpr {
     bool cached_offsets_inited_{false};
     ColumnVectorPtr cached_offsets_;
     TargetBitmap cached_bits_;
+    // TermSet<T> of the values, T is fixed by the column type
+    std::shared_ptr<void> term_set_;
 };
 }  //namespace exec
 }  // namespace milvus
@@ -0,0 +1,226 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "common/Types.h"
+
+namespace milvus {
+namespace exec {
+
+// The values of an `in` list, built once per expr and probed for every row.
+// The layout depends on the values:
+//   - up to kLinearMaxSize values are compared one by one, for a batch of
+//     numbers that is one vectorized compare per value;
+//   - integers spanning a small enough range go to a bitmap indexed by
+//     value - min;
+//   - other numbers up to kSortedMaxSize are binary searched;
+//   - everything else is hashed.
+template <typename T>
+class TermSet {
+    static_assert(!std::is_same_v<T, std::string_view>,
+                  "use TermSet<std::string> for string columns");
+
+ public:
+    // strings are probed without copying them
+    using ProbeType = std::
+        conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+    static constexpr size_t kLinearMaxSize = 16;
+    static constexpr size_t kSortedMaxSize = 256;
+    // a bitmap may use up to this many bits per value, or
+    // kBitmapMinBits, whichever is larger
+    static constexpr uint64_t kBitmapBitsPerValue = 64;
+    static constexpr uint64_t kBitmapMinBits = uint64_t(1) << 16;
+
+    explicit TermSet(std::vector<T> values) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // NaN equals nothing, it would also break the sort order
+            values.erase(std::remove_if(values.begin(),
+                                        values.end(),
+                                        [](T v) { return std::isnan(v); }),
+                         values.end());
+        }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        values_ = std::move(values);
+
+        if (values_.size() <= kLinearMaxSize) {
+            kind_ = Kind::Linear;
+            if constexpr (std::is_same_v<T, std::string>) {
+                probes_.assign(values_.begin(), values_.end());
+            }
+            return;
+        }
+        if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+            min_ = values_.front();
+            max_ = values_.back();
+            auto range = Distance(max_);
+            auto max_bits = std::max<uint64_t>(
+                kBitmapMinBits, kBitmapBitsPerValue * values_.size());
+            if (range < max_bits) {
+                kind_ = Kind::Bitmap;
+                bitmap_.resize(range + 1, false);
+                for (const auto& v : values_) {
+                    bitmap_[Distance(v)] = true;
+                }
+                return;
+            }
+        }
+        if constexpr (std::is_arithmetic_v<T>) {
+            if (values_.size() <= kSortedMaxSize) {
+                kind_ = Kind::Sorted;
+                return;
+            }
+        }
+        kind_ = Kind::Hash;
+        for (const auto& v : values_) {
+            hash_.insert(ProbeType(v));
+        }
+    }
+
+    TermSet(const TermSet&) = delete;
+    TermSet&
+    operator=(const TermSet&) = delete;
+
+    bool
+    empty() const {
+        return values_.empty();
+    }
+
+    size_t
+    size() const {
+        return values_.size();
+    }
+
+    bool
+    Contains(const ProbeType& value) const {
+        switch (kind_) {
+            case Kind::Linear:
+                return LinearContains(value);
+            case Kind::Bitmap:
+                if constexpr (std::is_integral_v<T> &&
+                              !std::is_same_v<T, bool>) {
+                    return value >= min_ && value <= max_ &&
+                           bitmap_[Distance(value)];
+                }
+                return false;
+            case Kind::Sorted:
+                return SortedContains(value);
+            default:
+                return hash_.find(value) != hash_.end();
+        }
+    }
+
+    // res[i] = data[i] is in the set, for i in [0, size).
+    void
+    BatchContains(const T* data, int64_t size, TargetBitmapView res) const {
+        if constexpr (std::is_arithmetic_v<T>) {
+            if (kind_ == Kind::Linear) {
+                if (values_.empty()) {
+                    res.view(0, size).reset();
+                    return;
+                }
+                res.inplace_compare_val<T, milvus::bitset::CompareOpType::EQ>(
+                    data, size, values_[0]);
+                if (values_.size() == 1) {
+                    return;
+                }
+                TargetBitmap matched(size);
+                for (size_t j = 1; j < values_.size(); ++j) {
+                    matched.inplace_compare_val<
+                        T,
+                        milvus::bitset::CompareOpType::EQ>(
+                        data, size, values_[j]);
+                    res.inplace_or(matched.view(), size);
+                }
+                return;
+            }
+        }
+        for (int64_t i = 0; i < size; ++i) {
+            res[i] = Contains(data[i]);
+        }
+    }
+
+ private:
+    enum class Kind { Linear, Bitmap, Sorted, Hash };
+
+    // value - min_ without signed overflow
+    uint64_t
+    Distance(const T& value) const {
+        if constexpr (std::is_integral_v<T>) {
+            return static_cast<uint64_t>(static_cast<int64_t>(value)) -
+                   static_cast<uint64_t>(static_cast<int64_t>(min_));
+        }
+        return 0;
+    }
+
+    bool
+    LinearContains(const ProbeType& value) const {
+        if constexpr (std::is_same_v<T, std::string>) {
+            for (const auto& v : probes_) {
+                if (v == value) {
+                    return true;
+                }
+            }
+            return false;
+        } else {
+            bool found = false;
+            for (const auto& v : values_) {
+                found |= v == value;
+            }
+            return found;
+        }
+    }
+
+    // branchless binary search, the last value not greater than `value`
+    bool
+    SortedContains(const ProbeType& value) const {
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+            const T* base = values_.data();
+            size_t len = values_.size();
+            while (len > 1) {
+                auto half = len / 2;
+                base = base[half] <= value ? base + half : base;
+                len -= half;
+            }
+            return *base == value;
+        }
+        return false;
+    }
+
+    Kind kind_{Kind::Linear};
+    // sorted and unique, also owns the strings probes_ and hash_ point to
+    std::vector<T> values_;
+    std::vector<ProbeType> probes_;
+    T min_{};
+    T max_{};
+    TargetBitmap bitmap_;
+    std::unordered_set<ProbeType> hash_;
+};
+
+}  // namespace exec
+}  // namespace milvus
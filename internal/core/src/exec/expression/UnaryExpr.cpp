@@ -145,6 +145,8 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplArrayForIndex<
 
 void
 PhyUnaryRangeFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
+    SetActiveRows(context);
+    SetOutput(context);
     switch (expr_->column_.data_type_) {
         case DataType::BOOL: {
             result = ExecRangeVisitorImpl<bool>();
@@ -430,6 +432,70 @@ PhyUnaryRangeFilterExpr::ExecArrayEqualForIndex(bool reverse) {
     return std::make_shared<ColumnVector>(std::move(batch_res));
 }
 
+template <typename ExprValueType>
+bool
+PhyUnaryRangeFilterExpr::CanUseJsonIndex() {
+    if constexpr (std::is_same_v<ExprValueType, proto::plan::Array>) {
+        return false;
+    } else {
+        if (cached_json_index_res_.has_value()) {
+            return true;
+        }
+        switch (expr_->op_type_) {
+            case proto::plan::GreaterThan:
+            case proto::plan::GreaterEqual:
+            case proto::plan::LessThan:
+            case proto::plan::LessEqual:
+                if constexpr (std::is_same_v<ExprValueType, bool>) {
+                    return false;
+                }
+                break;
+            case proto::plan::Equal:
+            case proto::plan::NotEqual:
+                break;
+            default:
+                return false;
+        }
+        auto val = GetValueFromProto<ExprValueType>(expr_->val_);
+        if (!IsExactInJsonIndex(val)) {
+            return false;
+        }
+        auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+        return GetJsonIndex<JsonIndexValueType<ExprValueType>>(pointer) !=
+               nullptr;
+    }
+}
+
+template <typename ExprValueType>
+VectorPtr
+PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonForIndex() {
+    if constexpr (std::is_same_v<ExprValueType, proto::plan::Array>) {
+        PanicInfo(DataTypeInvalid, "json index doesn't support array value");
+    } else {
+        using IndexInnerType = JsonIndexValueType<ExprValueType>;
+        auto op_type = expr_->op_type_;
+        auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+        auto execute = [&]() -> TargetBitmap {
+            auto index = GetJsonIndex<IndexInnerType>(pointer);
+            AssertInfo(index != nullptr,
+                       "json index of path {} not found",
+                       pointer);
+            auto val = IndexInnerType(
+                GetValueFromProto<ExprValueType>(expr_->val_));
+            switch (op_type) {
+                case proto::plan::Equal:
+                    return index->In(1, &val);
+                case proto::plan::NotEqual:
+                    // rows without a value at the path are not equal either
+                    return index->NotIn(1, &val);
+                default:
+                    return index->Range(val, op_type);
+            }
+        };
+        return ProcessJsonIndex(execute);
+    }
+}
+
 template <typename ExprValueType>
 VectorPtr
 PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson() {
@@ -437,6 +503,10 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson() {
         std::conditional_t<std::is_same_v<ExprValueType, std::string>,
                            std::string_view,
                            ExprValueType>;
+    if (CanUseJsonIndex<ExprValueType>()) {
+        return ExecRangeVisitorImplJsonForIndex<ExprValueType>();
+    }
+
     auto real_batch_size = GetNextBatchSize();
     if (real_batch_size == 0) {
         return nullptr;
@@ -772,8 +842,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData() {
         return nullptr;
     }
     IndexInnerType val = GetValueFromProto<IndexInnerType>(expr_->val_);
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size));
+    auto res_vec = AllocateResult(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     auto expr_type = expr_->op_type_;
     auto execute_sub_batch = [expr_type](const T* data,
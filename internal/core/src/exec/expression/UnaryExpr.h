@@ -289,6 +289,13 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
     void
     Eval(EvalCtx& context, VectorPtr& result) override;
 
+    void
+    MoveCursor() override {
+        SegmentExpr::MoveCursor();
+        overflow_check_pos_ +=
+            std::min(active_count_ - overflow_check_pos_, batch_size_);
+    }
+
  private:
     template <typename T>
     VectorPtr
@@ -306,6 +313,14 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
     VectorPtr
     ExecRangeVisitorImplJson();
 
+    template <typename ExprValueType>
+    bool
+    CanUseJsonIndex();
+
+    template <typename ExprValueType>
+    VectorPtr
+    ExecRangeVisitorImplJsonForIndex();
+
     template <typename ExprValueType>
     VectorPtr
     ExecRangeVisitorImplArray();
@@ -162,5 +162,23 @@ GetValueFromProtoWithOverflow(
     return GetValueFromProtoInternal<T>(value_proto, overflowed);
 }
 
+// json indexes store every number as double, an int64 operand can be looked
+// up there as long as the conversion is exact. Stored integers beyond 2^53
+// are rounded to doubles of at least that magnitude, so the operand must be
+// strictly inside (-2^53, 2^53) to compare with them the way raw data does.
+template <typename T>
+using JsonIndexValueType =
+    std::conditional_t<std::is_same_v<T, int64_t>, double, T>;
+
+template <typename T>
+bool
+IsExactInJsonIndex(const T& value) {
+    if constexpr (std::is_same_v<T, int64_t>) {
+        constexpr int64_t max_exact = int64_t(1) << 53;
+        return value > -max_exact && value < max_exact;
+    }
+    return true;
+}
+
 }  // namespace exec
 }  // namespace milvus
\ No newline at end of file
@@ -32,7 +32,21 @@ FilterBits::FilterBits(
     std::vector<expr::TypedExprPtr> filters;
     filters.emplace_back(filter->filter());
     exprs_ = std::make_unique<ExprSet>(filters, exec_context);
-    need_process_rows_ = query_context->get_active_count();
+    auto row_offset = query_context->get_row_offset();
+    if (row_offset > 0) {
+        // evaluating one morsel of the segment, skip the leading batches
+        auto batch_size = query_context->query_config()->get_expr_batch_size();
+        AssertInfo(row_offset % batch_size == 0,
+                   "row offset {} should be a multiple of expr batch size {}",
+                   row_offset,
+                   batch_size);
+        for (int64_t i = 0; i < row_offset / batch_size; ++i) {
+            for (auto& expr : exprs_->exprs()) {
+                expr->MoveCursor();
+            }
+        }
+    }
+    need_process_rows_ = query_context->get_active_count() - row_offset;
     num_processed_rows_ = 0;
 }
 
@@ -63,6 +77,20 @@ FilterBits::GetOutput() {
 
     EvalCtx eval_ctx(
         operator_context_->get_exec_context(), exprs_.get(), input_.get());
+    auto query_context =
+        operator_context_->get_exec_context()->get_query_context();
+    if (auto output = query_context->get_output(); output != nullptr) {
+        // only a slice starting at a word can be handed out as a raw pointer
+        constexpr int64_t kWordBits = sizeof(TargetBitmap::data_type) * 8;
+        auto offset = query_context->get_row_offset() + num_processed_rows_;
+        auto size =
+            std::min(query_context->query_config()->get_expr_batch_size(),
+                     need_process_rows_ - num_processed_rows_);
+        if (offset % kWordBits == 0) {
+            eval_ctx.set_output(
+                TargetBitmapView(output->data() + offset / kWordBits, size));
+        }
+    }
 
     exprs_->Eval(0, 1, true, eval_ctx, results_);
 
@@ -11,9 +11,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <type_traits>
 #include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/executors/task_queue/PriorityLifoSemMPMCQueue.h>
+#include <folly/synchronization/Baton.h>
 #include <folly/system/HardwareConcurrency.h>
 
 namespace milvus::futures {
@@ -27,4 +33,88 @@ const int HIGH = 0;
 folly::CPUThreadPoolExecutor*
 getGlobalCPUExecutor();
 
+// Runs `task(i)` for every i in [0, num_tasks) with at most `parallelism`
+// workers, the helper workers are started by `spawn(worker)`. Tasks are
+// claimed through a shared cursor and the calling thread is a worker too, so
+// it only ever waits for tasks that are already running, and the loop
+// finishes even if a spawned worker never gets to run. The first exception
+// thrown by a task is rethrown once every task has finished.
+// A task taking two arguments is called as `task(i, worker_id)`, worker ids
+// are in [0, min(parallelism, num_tasks)) and 0 is the calling thread, so
+// tasks can keep per-worker state without locking.
+template <typename Spawn, typename Task>
+void
+ParallelForEach(int64_t num_tasks,
+                int64_t parallelism,
+                const Spawn& spawn,
+                const Task& task) {
+    auto run = [&task](int64_t i, int64_t worker_id) {
+        if constexpr (std::is_invocable_v<const Task&, int64_t, int64_t>) {
+            task(i, worker_id);
+        } else {
+            task(i);
+        }
+    };
+    auto num_workers = std::max<int64_t>(1, std::min(parallelism, num_tasks));
+    if (num_workers == 1) {
+        for (int64_t i = 0; i < num_tasks; ++i) {
+            run(i, 0);
+        }
+        return;
+    }
+
+    struct State {
+        std::atomic<int64_t> next{0};
+        std::atomic<int64_t> pending{0};
+        std::mutex error_mutex;
+        std::exception_ptr error;
+        folly::Baton<> done;
+    };
+    auto state = std::make_shared<State>();
+    state->pending = num_tasks;
+    auto make_worker = [state, num_tasks, &run](int64_t worker_id) {
+        return [state, num_tasks, &run, worker_id]() {
+            while (true) {
+                auto i = state->next.fetch_add(1);
+                if (i >= num_tasks) {
+                    return;
+                }
+                try {
+                    run(i, worker_id);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(state->error_mutex);
+                    if (!state->error) {
+                        state->error = std::current_exception();
+                    }
+                }
+                if (state->pending.fetch_sub(1) == 1) {
+                    state->done.post();
+                }
+            }
+        };
+    };
+    for (int64_t worker_id = 1; worker_id < num_workers; ++worker_id) {
+        spawn(make_worker(worker_id));
+    }
+    make_worker(0)();
+    state->done.wait();
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+// ParallelForEach with the helper workers on the global CPU executor.
+template <typename Task>
+void
+ParallelForEach(int64_t num_tasks, int64_t parallelism, const Task& task) {
+    ParallelForEach(
+        num_tasks,
+        parallelism,
+        [](auto worker) {
+            getGlobalCPUExecutor()->addWithPriority(std::move(worker),
+                                                    ExecutePriority::HIGH);
+        },
+        task);
+}
+
 };  // namespace milvus::futures
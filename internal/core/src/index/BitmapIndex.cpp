@@ -15,6 +15,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <set>
 #include <boost/algorithm/string.hpp>
 #include <sys/errno.h>
 #include <unistd.h>
@@ -1127,6 +1128,118 @@ BitmapIndex<T>::Reverse_Lookup(size_t idx) const {
                   idx));
 }
 
+template <typename T>
+int64_t
+BitmapIndex<T>::CountPostings(
+    const std::vector<const roaring::Roaring*>& postings,
+    const std::vector<int64_t>& excluded) const {
+    roaring::Roaring excluded_set;
+    for (const auto offset : excluded) {
+        excluded_set.add(static_cast<uint32_t>(offset));
+    }
+    int64_t count = 0;
+    for (const auto posting : postings) {
+        count += posting->cardinality() -
+                 posting->and_cardinality(excluded_set);
+    }
+    return count;
+}
+
+template <typename T>
+int64_t
+BitmapIndex<T>::CountPostings(const std::vector<const TargetBitmap*>& postings,
+                              const std::vector<int64_t>& excluded) const {
+    if (postings.empty()) {
+        return 0;
+    }
+    // postings of different values are disjoint, their union holds every
+    // matching row exactly once
+    TargetBitmap matched(total_num_rows_, false);
+    for (const auto posting : postings) {
+        matched |= *posting;
+    }
+    int64_t count = matched.count();
+    for (const auto offset : excluded) {
+        if (static_cast<size_t>(offset) < matched.size() && matched[offset]) {
+            --count;
+        }
+    }
+    return count;
+}
+
+template <typename T>
+std::optional<int64_t>
+BitmapIndex<T>::CountRange(const T value,
+                           const OpType op,
+                           const std::vector<int64_t>& excluded) const {
+    AssertInfo(is_built_, "index has not been built");
+    // postings of a mmapped index are deserialized on every access
+    if (is_mmap_) {
+        return std::nullopt;
+    }
+
+    if (op != OpType::LessThan && op != OpType::LessEqual &&
+        op != OpType::GreaterThan && op != OpType::GreaterEqual) {
+        return std::nullopt;
+    }
+
+    auto count_range = [&](const auto& postings) {
+        auto lb = postings.begin();
+        auto ub = postings.end();
+        if (op == OpType::LessThan) {
+            ub = postings.lower_bound(value);
+        } else if (op == OpType::LessEqual) {
+            ub = postings.upper_bound(value);
+        } else if (op == OpType::GreaterThan) {
+            lb = postings.upper_bound(value);
+        } else {
+            lb = postings.lower_bound(value);
+        }
+        std::vector<const typename std::decay_t<
+            decltype(postings)>::mapped_type*>
+            matched;
+        for (; lb != ub; ++lb) {
+            matched.push_back(&lb->second);
+        }
+        return CountPostings(matched, excluded);
+    };
+
+    if (build_mode_ == BitmapIndexBuildMode::ROARING) {
+        return count_range(data_);
+    }
+    return count_range(bitsets_);
+}
+
+template <typename T>
+std::optional<int64_t>
+BitmapIndex<T>::CountIn(const size_t n,
+                        const T* values,
+                        const std::vector<int64_t>& excluded) const {
+    AssertInfo(is_built_, "index has not been built");
+    if (is_mmap_) {
+        return std::nullopt;
+    }
+
+    std::set<T> targets(values, values + n);
+    auto count_in = [&](const auto& postings) {
+        std::vector<const typename std::decay_t<
+            decltype(postings)>::mapped_type*>
+            matched;
+        for (const auto& target : targets) {
+            auto it = postings.find(target);
+            if (it != postings.end()) {
+                matched.push_back(&it->second);
+            }
+        }
+        return CountPostings(matched, excluded);
+    };
+
+    if (build_mode_ == BitmapIndexBuildMode::ROARING) {
+        return count_in(data_);
+    }
+    return count_in(bitsets_);
+}
+
 template <typename T>
 bool
 BitmapIndex<T>::ShouldSkip(const T lower_value,
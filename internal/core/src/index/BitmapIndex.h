@@ -109,6 +109,16 @@ class BitmapIndex : public ScalarIndex<T> {
     T
     Reverse_Lookup(size_t offset) const override;
 
+    std::optional<int64_t>
+    CountRange(T value,
+               OpType op,
+               const std::vector<int64_t>& excluded) const override;
+
+    std::optional<int64_t>
+    CountIn(size_t n,
+            const T* values,
+            const std::vector<int64_t>& excluded) const override;
+
     int64_t
     Size() override {
         return Count();
@@ -206,6 +216,15 @@ class BitmapIndex : public ScalarIndex<T> {
     TargetBitmap
     ConvertRoaringToBitset(const roaring::Roaring& values);
 
+    // number of rows in `postings` that are not in `excluded`
+    int64_t
+    CountPostings(const std::vector<const roaring::Roaring*>& postings,
+                  const std::vector<int64_t>& excluded) const;
+
+    int64_t
+    CountPostings(const std::vector<const TargetBitmap*>& postings,
+                  const std::vector<int64_t>& excluded) const;
+
     TargetBitmap
     RangeForRoaring(T value, OpType op);
 
@@ -138,6 +138,20 @@ class HybridScalarIndex : public ScalarIndex<T> {
         return internal_index_->Reverse_Lookup(offset);
     }
 
+    std::optional<int64_t>
+    CountRange(T value,
+               OpType op,
+               const std::vector<int64_t>& excluded) const override {
+        return internal_index_->CountRange(value, op, excluded);
+    }
+
+    std::optional<int64_t>
+    CountIn(size_t n,
+            const T* values,
+            const std::vector<int64_t>& excluded) const override {
+        return internal_index_->CountIn(n, values, excluded);
+    }
+
     int64_t
     Size() override {
         return internal_index_->Size();
@@ -28,6 +28,7 @@
 #include "index/BoolIndex.h"
 #include "index/InvertedIndexTantivy.h"
 #include "index/HybridScalarIndex.h"
+#include "index/JsonInvertedIndex.h"
 
 namespace milvus::index {
 
@@ -150,9 +151,32 @@ IndexFactory::CreateCompositeScalarIndex(
 
 IndexBasePtr
 IndexFactory::CreateComplexScalarIndex(
-    IndexType index_type,
+    const CreateIndexInfo& create_index_info,
     const storage::FileManagerContext& file_manager_context) {
-    PanicInfo(Unsupported, "Complex index not supported now");
+    auto index_type = create_index_info.index_type;
+    if (index_type != INVERTED_INDEX_TYPE) {
+        PanicInfo(
+            Unsupported,
+            fmt::format("index type: {} for json not supported now",
+                        index_type));
+    }
+    auto& json_path = create_index_info.json_path;
+    AssertInfo(!json_path.empty(), "json path is empty for json index");
+    switch (create_index_info.json_cast_type) {
+        case DataType::BOOL:
+            return std::make_unique<JsonInvertedIndex<bool>>(
+                json_path, file_manager_context);
+        case DataType::DOUBLE:
+            return std::make_unique<JsonInvertedIndex<double>>(
+                json_path, file_manager_context);
+        case DataType::VARCHAR:
+            return std::make_unique<JsonInvertedIndex<std::string>>(
+                json_path, file_manager_context);
+        default:
+            PanicInfo(DataTypeInvalid,
+                      fmt::format("invalid json cast type: {}",
+                                  create_index_info.json_cast_type));
+    }
 }
 
 IndexBasePtr
@@ -177,7 +201,7 @@ IndexFactory::CreateScalarIndex(
                                               file_manager_context);
         }
         case DataType::JSON: {
-            return CreateComplexScalarIndex(create_index_info.index_type,
+            return CreateComplexScalarIndex(create_index_info,
                                             file_manager_context);
         }
         default:
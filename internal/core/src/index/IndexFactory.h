@@ -77,7 +77,7 @@ class IndexFactory {
     // For types like Json, XML, etc
     IndexBasePtr
     CreateComplexScalarIndex(
-        IndexType index_type,
+        const CreateIndexInfo& create_index_info,
         const storage::FileManagerContext& file_manager_context =
             storage::FileManagerContext());
 
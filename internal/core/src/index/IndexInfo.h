@@ -26,6 +26,9 @@ struct CreateIndexInfo {
     IndexVersion index_engine_version;
     std::string field_name;
     int64_t dim;
+    // only for json index
+    std::string json_path;
+    DataType json_cast_type{DataType::NONE};
 };
 
 }  // namespace milvus::index
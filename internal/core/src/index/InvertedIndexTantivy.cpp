@@ -71,7 +71,15 @@ get_tantivy_data_type(const proto::schema::FieldSchema& schema) {
 template <typename T>
 InvertedIndexTantivy<T>::InvertedIndexTantivy(
     const storage::FileManagerContext& ctx)
+    : InvertedIndexTantivy(
+          ctx, get_tantivy_data_type(ctx.fieldDataMeta.field_schema)) {
+}
+
+template <typename T>
+InvertedIndexTantivy<T>::InvertedIndexTantivy(
+    const storage::FileManagerContext& ctx, TantivyDataType d_type)
     : ScalarIndex<T>(INVERTED_INDEX_TYPE),
+      d_type_(d_type),
       schema_(ctx.fieldDataMeta.field_schema) {
     mem_file_manager_ = std::make_shared<MemFileManager>(ctx);
     disk_file_manager_ = std::make_shared<DiskFileManager>(ctx);
@@ -80,7 +88,6 @@ InvertedIndexTantivy<T>::InvertedIndexTantivy(
     auto prefix = disk_file_manager_->GetIndexIdentifier();
     path_ = std::string(TMP_INVERTED_INDEX_PREFIX) + prefix;
     boost::filesystem::create_directories(path_);
-    d_type_ = get_tantivy_data_type(schema_);
     if (tantivy_index_exist(path_.c_str())) {
         LOG_INFO(
             "index {} already exists, which should happen in loading progress",
@@ -176,6 +176,12 @@ class InvertedIndexTantivy : public ScalarIndex<T> {
     void
     BuildWithFieldData(const std::vector<FieldDataPtr>& datas) override;
 
+ protected:
+    // used by indexes whose indexed values are not typed by the field
+    // schema, e.g. values extracted from a JSON field.
+    InvertedIndexTantivy(const storage::FileManagerContext& ctx,
+                         TantivyDataType d_type);
+
  private:
     void
     finish();
@@ -184,7 +190,7 @@ class InvertedIndexTantivy : public ScalarIndex<T> {
     build_index_for_array(
         const std::vector<std::shared_ptr<FieldDataBase>>& field_datas);
 
- private:
+ protected:
     std::shared_ptr<TantivyIndexWrapper> wrapper_;
     TantivyDataType d_type_;
     std::string path_;
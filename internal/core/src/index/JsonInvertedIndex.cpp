@@ -0,0 +1,80 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "index/JsonInvertedIndex.h"
+
+#include "common/Json.h"
+#include "log/Log.h"
+
+namespace milvus::index {
+
+template <typename T>
+inline TantivyDataType
+get_json_tantivy_data_type() {
+    if constexpr (std::is_same_v<T, bool>) {
+        return TantivyDataType::Bool;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return TantivyDataType::F64;
+    } else {
+        static_assert(std::is_same_v<T, std::string>,
+                      "unsupported json index value type");
+        return TantivyDataType::Keyword;
+    }
+}
+
+template <typename T>
+JsonInvertedIndex<T>::JsonInvertedIndex(
+    const std::string& json_path, const storage::FileManagerContext& ctx)
+    : InvertedIndexTantivy<T>(ctx, get_json_tantivy_data_type<T>()),
+      json_path_(json_path) {
+}
+
+template <typename T>
+void
+JsonInvertedIndex<T>::BuildWithFieldData(
+    const std::vector<FieldDataPtr>& field_datas) {
+    using GetType =
+        std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+    // rows without a value are added as documents without terms
+    T empty{};
+    int64_t offset = 0;
+    int64_t indexed = 0;
+    for (const auto& data : field_datas) {
+        auto n = data->get_num_rows();
+        for (int64_t i = 0; i < n; i++) {
+            if (!data->is_valid(i)) {
+                this->null_offset.push_back(offset);
+                this->wrapper_->template add_multi_data<T>(&empty, 0, offset);
+                offset++;
+                continue;
+            }
+            auto json = static_cast<const Json*>(data->RawValue(i));
+            auto value = json->template at<GetType>(json_path_);
+            if (value.error()) {
+                this->wrapper_->template add_multi_data<T>(&empty, 0, offset);
+            } else {
+                T v = T(value.value());
+                this->wrapper_->template add_multi_data<T>(&v, 1, offset);
+                indexed++;
+            }
+            offset++;
+        }
+    }
+    LOG_INFO("json inverted index on path {} built, {} of {} rows indexed",
+             json_path_,
+             indexed,
+             offset);
+}
+
+template class JsonInvertedIndex<bool>;
+template class JsonInvertedIndex<double>;
+template class JsonInvertedIndex<std::string>;
+}  // namespace milvus::index
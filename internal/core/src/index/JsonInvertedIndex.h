@@ -0,0 +1,47 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "index/InvertedIndexTantivy.h"
+
+namespace milvus::index {
+
+// Inverted index over the values found at one path of a JSON field.
+//
+// Every row of the segment is a document of the index, rows where the path
+// is missing or holds a value that can't be cast to T have no term, so
+// `In`/`Range` only hit rows whose value at the path matches, while `NotIn`
+// also returns them, the same as evaluating the expression on raw JSON.
+// T is one of bool, double (all JSON numbers) and std::string.
+template <typename T>
+class JsonInvertedIndex : public InvertedIndexTantivy<T> {
+ public:
+    JsonInvertedIndex(const std::string& json_path,
+                      const storage::FileManagerContext& ctx);
+
+    void
+    BuildWithFieldData(const std::vector<FieldDataPtr>& datas) override;
+
+    const std::string&
+    GetJsonPath() const {
+        return json_path_;
+    }
+
+ private:
+    // JSON pointer of the indexed path, e.g. "/tenant"
+    std::string json_path_;
+};
+
+}  // namespace milvus::index
@@ -29,6 +29,7 @@ constexpr const char* PREFIX_VALUE = "prefix_value";
 // below configurations will be persistent, do not edit them.
 constexpr const char* MARISA_TRIE_INDEX = "marisa_trie_index";
 constexpr const char* MARISA_STR_IDS = "marisa_trie_str_ids";
+constexpr const char* MARISA_SORTED_STR_IDS = "marisa_trie_sorted_str_ids";
 
 // below meta key of store bitmap indexes
 constexpr const char* BITMAP_INDEX_DATA = "bitmap_index_data";
@@ -57,6 +58,10 @@ constexpr const char* INDEX_VERSION = "index_version";
 constexpr const char* INDEX_ENGINE_VERSION = "index_engine_version";
 constexpr const char* BITMAP_INDEX_CARDINALITY_LIMIT =
     "bitmap_cardinality_limit";
+// JSON pointer of the indexed path of a json index, e.g. "/tenant"
+constexpr const char* JSON_PATH = "json_path";
+// type the values at the path are cast to: BOOL, DOUBLE or VARCHAR
+constexpr const char* JSON_CAST_TYPE = "json_cast_type";
 
 // index config key
 constexpr const char* MMAP_FILE_PATH = "mmap_filepath";
@@ -19,7 +19,9 @@
 #include <boost/dynamic_bitset.hpp>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "common/Types.h"
 #include "common/EasyAssert.h"
@@ -120,6 +122,24 @@ class ScalarIndex : public IndexBase {
     virtual T
     Reverse_Lookup(size_t offset) const = 0;
 
+    // Count the rows matching `op value` without materializing a bitset.
+    // Rows listed in `excluded` (ascending offsets) are not counted.
+    // Returns std::nullopt if the index can't produce an exact count.
+    virtual std::optional<int64_t>
+    CountRange(T value,
+               OpType op,
+               const std::vector<int64_t>& excluded) const {
+        return std::nullopt;
+    }
+
+    // Same as CountRange(), for the rows whose value is one of `values`.
+    virtual std::optional<int64_t>
+    CountIn(size_t n,
+            const T* values,
+            const std::vector<int64_t>& excluded) const {
+        return std::nullopt;
+    }
+
     virtual const TargetBitmap
     Query(const DatasetPtr& dataset);
 
@@ -364,6 +364,85 @@ ScalarIndexSort<T>::Reverse_Lookup(size_t idx) const {
     return data_[offset].a_;
 }
 
+template <typename T>
+std::optional<int64_t>
+ScalarIndexSort<T>::CountRange(const T value,
+                               const OpType op,
+                               const std::vector<int64_t>& excluded) const {
+    AssertInfo(is_built_, "index has not been built");
+    auto lb = data_.begin();
+    auto ub = data_.end();
+    switch (op) {
+        case OpType::LessThan:
+            ub = std::lower_bound(
+                data_.begin(), data_.end(), IndexStructure<T>(value));
+            break;
+        case OpType::LessEqual:
+            ub = std::upper_bound(
+                data_.begin(), data_.end(), IndexStructure<T>(value));
+            break;
+        case OpType::GreaterThan:
+            lb = std::upper_bound(
+                data_.begin(), data_.end(), IndexStructure<T>(value));
+            break;
+        case OpType::GreaterEqual:
+            lb = std::lower_bound(
+                data_.begin(), data_.end(), IndexStructure<T>(value));
+            break;
+        default:
+            return std::nullopt;
+    }
+    if (lb >= ub) {
+        return 0;
+    }
+
+    // matching rows occupy [lb, ub) of the sorted data, an excluded row is
+    // subtracted if its position falls inside
+    const size_t lb_pos = lb - data_.begin();
+    const size_t ub_pos = ub - data_.begin();
+    int64_t count = ub_pos - lb_pos;
+    for (const auto offset : excluded) {
+        if (static_cast<size_t>(offset) >= total_num_rows_ ||
+            !valid_bitset[offset]) {
+            continue;
+        }
+        const size_t pos = idx_to_offsets_[offset];
+        if (pos >= lb_pos && pos < ub_pos) {
+            --count;
+        }
+    }
+    return count;
+}
+
+template <typename T>
+std::optional<int64_t>
+ScalarIndexSort<T>::CountIn(const size_t n,
+                            const T* values,
+                            const std::vector<int64_t>& excluded) const {
+    AssertInfo(is_built_, "index has not been built");
+    std::vector<T> targets(values, values + n);
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+    int64_t count = 0;
+    for (const auto& target : targets) {
+        auto [lb, ub] = std::equal_range(
+            data_.begin(), data_.end(), IndexStructure<T>(target));
+        count += ub - lb;
+    }
+    for (const auto offset : excluded) {
+        if (static_cast<size_t>(offset) >= total_num_rows_ ||
+            !valid_bitset[offset]) {
+            continue;
+        }
+        const auto& value = data_[idx_to_offsets_[offset]].a_;
+        if (std::binary_search(targets.begin(), targets.end(), value)) {
+            --count;
+        }
+    }
+    return count;
+}
+
 template <typename T>
 bool
 ScalarIndexSort<T>::ShouldSkip(const T lower_value,
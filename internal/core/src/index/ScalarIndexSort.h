@@ -85,6 +85,16 @@ class ScalarIndexSort : public ScalarIndex<T> {
     T
     Reverse_Lookup(size_t offset) const override;
 
+    std::optional<int64_t>
+    CountRange(T value,
+               OpType op,
+               const std::vector<int64_t>& excluded) const override;
+
+    std::optional<int64_t>
+    CountIn(size_t n,
+            const T* values,
+            const std::vector<int64_t>& excluded) const override;
+
     int64_t
     Size() override {
         return (int64_t)data_.size();
@@ -17,6 +17,7 @@
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/uuid/uuid_generators.hpp>
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <stdlib.h>
@@ -112,6 +113,7 @@ StringIndexMarisa::BuildWithFieldData(
 
     // fill str_ids_to_offsets_
     fill_offsets();
+    fill_sorted_str_ids();
 
     built_ = true;
 }
@@ -133,6 +135,7 @@ StringIndexMarisa::Build(size_t n, const std::string* values) {
     trie_.build(keyset);
     fill_str_ids(n, values);
     fill_offsets();
+    fill_sorted_str_ids();
 
     built_ = true;
 }
@@ -159,9 +162,14 @@ StringIndexMarisa::Serialize(const Config& config) {
     std::shared_ptr<uint8_t[]> str_ids(new uint8_t[str_ids_len]);
     memcpy(str_ids.get(), str_ids_.data(), str_ids_len);
 
+    auto sorted_str_ids_len = sorted_str_ids_.size() * sizeof(size_t);
+    std::shared_ptr<uint8_t[]> sorted_str_ids(new uint8_t[sorted_str_ids_len]);
+    memcpy(sorted_str_ids.get(), sorted_str_ids_.data(), sorted_str_ids_len);
+
     BinarySet res_set;
     res_set.Append(MARISA_TRIE_INDEX, index_data, size);
     res_set.Append(MARISA_STR_IDS, str_ids, str_ids_len);
+    res_set.Append(MARISA_SORTED_STR_IDS, sorted_str_ids, sorted_str_ids_len);
 
     Disassemble(res_set);
 
@@ -216,6 +224,18 @@ StringIndexMarisa::LoadWithoutAssemble(const BinarySet& set,
     memcpy(str_ids_.data(), str_ids->data.get(), str_ids_len);
 
     fill_offsets();
+
+    // indexes built by older versions don't carry the sorted key ids
+    auto sorted_str_ids = set.GetByName(MARISA_SORTED_STR_IDS);
+    if (sorted_str_ids != nullptr) {
+        auto sorted_str_ids_len = sorted_str_ids->size;
+        sorted_str_ids_.resize(sorted_str_ids_len / sizeof(size_t));
+        memcpy(sorted_str_ids_.data(),
+               sorted_str_ids->data.get(),
+               sorted_str_ids_len);
+    } else {
+        fill_sorted_str_ids();
+    }
 }
 
 void
@@ -307,53 +327,23 @@ const TargetBitmap
 StringIndexMarisa::Range(std::string value, OpType op) {
     auto count = Count();
     TargetBitmap bitset(count);
-    std::vector<size_t> ids;
-    marisa::Agent agent;
+    size_t begin = 0;
+    size_t end = sorted_str_ids_.size();
     switch (op) {
         case OpType::GreaterThan: {
-            while (trie_.predictive_search(agent)) {
-                auto key = std::string(agent.key().ptr(), agent.key().length());
-                if (key > value) {
-                    ids.push_back(agent.key().id());
-                    break;
-                }
-            };
-            while (trie_.predictive_search(agent)) {
-                ids.push_back(agent.key().id());
-            }
+            begin = sorted_lower_bound(value, false);
             break;
         }
         case OpType::GreaterEqual: {
-            while (trie_.predictive_search(agent)) {
-                auto key = std::string(agent.key().ptr(), agent.key().length());
-                if (key >= value) {
-                    ids.push_back(agent.key().id());
-                    break;
-                }
-            }
-            while (trie_.predictive_search(agent)) {
-                ids.push_back(agent.key().id());
-            }
+            begin = sorted_lower_bound(value, true);
             break;
         }
         case OpType::LessThan: {
-            while (trie_.predictive_search(agent)) {
-                auto key = std::string(agent.key().ptr(), agent.key().length());
-                if (key >= value) {
-                    break;
-                }
-                ids.push_back(agent.key().id());
-            }
+            end = sorted_lower_bound(value, true);
             break;
         }
         case OpType::LessEqual: {
-            while (trie_.predictive_search(agent)) {
-                auto key = std::string(agent.key().ptr(), agent.key().length());
-                if (key > value) {
-                    break;
-                }
-                ids.push_back(agent.key().id());
-            }
+            end = sorted_lower_bound(value, false);
             break;
         }
         default:
@@ -362,12 +352,7 @@ StringIndexMarisa::Range(std::string value, OpType op) {
                 fmt::format("Invalid OperatorType: {}", static_cast<int>(op)));
     }
 
-    for (const auto str_id : ids) {
-        auto offsets = str_ids_to_offsets_[str_id];
-        for (auto offset : offsets) {
-            bitset[offset] = true;
-        }
-    }
+    fill_sorted_range(bitset, begin, end);
     return bitset;
 }
 
@@ -384,37 +369,9 @@ StringIndexMarisa::Range(std::string lower_bound_value,
         return bitset;
     }
 
-    auto common_prefix = GetCommonPrefix(lower_bound_value, upper_bound_value);
-    marisa::Agent agent;
-    agent.set_query(common_prefix.c_str());
-    std::vector<size_t> ids;
-    while (trie_.predictive_search(agent)) {
-        std::string_view val =
-            std::string_view(agent.key().ptr(), agent.key().length());
-        if (val > upper_bound_value ||
-            (!ub_inclusive && val == upper_bound_value)) {
-            break;
-        }
-
-        if (val < lower_bound_value ||
-            (!lb_inclusive && val == lower_bound_value)) {
-            continue;
-        }
-
-        if (((lb_inclusive && lower_bound_value <= val) ||
-             (!lb_inclusive && lower_bound_value < val)) &&
-            ((ub_inclusive && val <= upper_bound_value) ||
-             (!ub_inclusive && val < upper_bound_value))) {
-            ids.push_back(agent.key().id());
-        }
-    }
-    for (const auto str_id : ids) {
-        auto offsets = str_ids_to_offsets_[str_id];
-        for (auto offset : offsets) {
-            bitset[offset] = true;
-        }
-    }
-
+    auto begin = sorted_lower_bound(lower_bound_value, lb_inclusive);
+    auto end = sorted_lower_bound(upper_bound_value, !ub_inclusive);
+    fill_sorted_range(bitset, begin, end);
     return bitset;
 }
 
@@ -453,6 +410,54 @@ StringIndexMarisa::fill_offsets() {
     }
 }
 
+void
+StringIndexMarisa::fill_sorted_str_ids() {
+    std::vector<std::pair<std::string, size_t>> keys;
+    keys.reserve(trie_.num_keys());
+    marisa::Agent agent;
+    agent.set_query("");
+    while (trie_.predictive_search(agent)) {
+        keys.emplace_back(std::string(agent.key().ptr(), agent.key().length()),
+                          agent.key().id());
+    }
+    std::sort(keys.begin(), keys.end());
+
+    sorted_str_ids_.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        sorted_str_ids_[i] = keys[i].second;
+    }
+}
+
+size_t
+StringIndexMarisa::sorted_lower_bound(std::string_view value,
+                                      bool inclusive) const {
+    marisa::Agent agent;
+    auto it = std::partition_point(
+        sorted_str_ids_.begin(), sorted_str_ids_.end(), [&](size_t str_id) {
+            agent.set_query(str_id);
+            trie_.reverse_lookup(agent);
+            auto key =
+                std::string_view(agent.key().ptr(), agent.key().length());
+            return inclusive ? key < value : key <= value;
+        });
+    return it - sorted_str_ids_.begin();
+}
+
+void
+StringIndexMarisa::fill_sorted_range(TargetBitmap& bitset,
+                                     size_t begin,
+                                     size_t end) {
+    for (size_t i = begin; i < end; i++) {
+        auto it = str_ids_to_offsets_.find(sorted_str_ids_[i]);
+        if (it == str_ids_to_offsets_.end()) {
+            continue;
+        }
+        for (auto offset : it->second) {
+            bitset[offset] = true;
+        }
+    }
+}
+
 size_t
 StringIndexMarisa::lookup(const std::string_view str) {
     marisa::Agent agent;
@@ -479,8 +484,13 @@ StringIndexMarisa::prefix_match(const std::string_view prefix) {
 std::string
 StringIndexMarisa::Reverse_Lookup(size_t offset) const {
     AssertInfo(offset < str_ids_.size(), "out of range of total count");
+    return KeyById(str_ids_[offset]);
+}
+
+std::string
+StringIndexMarisa::KeyById(size_t key_id) const {
     marisa::Agent agent;
-    agent.set_query(str_ids_[offset]);
+    agent.set_query(key_id);
     trie_.reverse_lookup(agent);
     return std::string(agent.key().ptr(), agent.key().length());
 }
@@ -19,6 +19,7 @@
 #include <marisa.h>
 #include "index/StringIndex.h"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <memory>
@@ -90,6 +91,16 @@ class StringIndexMarisa : public StringIndex {
     std::string
     Reverse_Lookup(size_t offset) const override;
 
+    // id of the trie key stored at `offset`. Ids are dense in the number of
+    // distinct keys, so they can stand in for the values themselves.
+    size_t
+    KeyId(size_t offset) const {
+        return str_ids_[offset];
+    }
+
+    std::string
+    KeyById(size_t key_id) const;
+
     BinarySet
     Upload(const Config& config = {}) override;
 
@@ -105,6 +116,20 @@ class StringIndexMarisa : public StringIndex {
     void
     fill_offsets();
 
+    // sort all keys of the trie lexicographically, marisa enumerates keys
+    // in its own order which is not usable for range queries.
+    void
+    fill_sorted_str_ids();
+
+    // position in sorted_str_ids_ of the first key not less than `value`,
+    // or greater than `value` if `inclusive` is false.
+    size_t
+    sorted_lower_bound(std::string_view value, bool inclusive) const;
+
+    // set the offsets of the keys sorted_str_ids_[begin, end).
+    void
+    fill_sorted_range(TargetBitmap& bitset, size_t begin, size_t end);
+
     // get str_id by str, if str not found, -1 was returned.
     size_t
     lookup(const std::string_view str);
@@ -120,6 +145,7 @@ class StringIndexMarisa : public StringIndex {
     Config config_;
     marisa::Trie trie_;
     std::vector<size_t> str_ids_;  // used to retrieve.
+    std::vector<size_t> sorted_str_ids_;  // str ids in key order.
     std::map<size_t, std::vector<size_t>> str_ids_to_offsets_;
     bool built_ = false;
     std::shared_ptr<storage::MemFileManagerImpl> file_manager_;
@@ -163,6 +163,25 @@ GetBitmapCardinalityLimitFromConfig(const Config& config) {
     return (std::stoi(bitmap_limit.value()));
 }
 
+DataType
+GetJsonCastTypeFromConfig(const Config& config) {
+    auto cast_type =
+        GetValueFromConfig<std::string>(config, index::JSON_CAST_TYPE);
+    AssertInfo(cast_type.has_value(), "json cast type not exist in config");
+    auto type = boost::algorithm::to_upper_copy(cast_type.value());
+    if (type == "BOOL") {
+        return DataType::BOOL;
+    }
+    if (type == "DOUBLE") {
+        return DataType::DOUBLE;
+    }
+    if (type == "VARCHAR") {
+        return DataType::VARCHAR;
+    }
+    PanicInfo(DataTypeInvalid,
+              fmt::format("unsupported json cast type: {}", cast_type.value()));
+}
+
 // TODO :: too ugly
 storage::FieldDataMeta
 GetFieldDataMetaFromConfig(const Config& config) {
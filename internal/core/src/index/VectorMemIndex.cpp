@@ -17,6 +17,7 @@
 #include "index/VectorMemIndex.h"
 
 #include <unistd.h>
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <filesystem>
@@ -517,14 +518,14 @@ void VectorMemIndex<T>::LoadFromFile(const Config& config) {
     }
 
     LOG_INFO("load with slice meta: {}", !slice_meta_filepath.empty());
-    std::chrono::duration<double> load_duration_sum;
-    std::chrono::duration<double> write_disk_duration_sum;
+    // download and write to disk are pipelined, the writer appends the
+    // slices in order while the following slices are being downloaded
+    storage::DownloadToFileStats stats;
+    int64_t file_offset = 0;
     if (!slice_meta_filepath
              .empty()) {  // load with the slice meta info, then we can load batch by batch
         std::string index_file_prefix = slice_meta_filepath.substr(
             0, slice_meta_filepath.find_last_of('/') + 1);
-        std::vector<std::string> batch{};
-        batch.reserve(parallel_degree);
 
         auto result = file_manager_->LoadIndexToMemory({slice_meta_filepath});
         auto raw_slice_meta = result[INDEX_FILE_SLICE_META];
@@ -535,59 +536,46 @@ void VectorMemIndex<T>::LoadFromFile(const Config& config) {
         for (auto& item : meta_data[META]) {
             std::string prefix = item[NAME];
             int slice_num = item[SLICE_NUM];
-            auto total_len = static_cast<size_t>(item[TOTAL_LEN]);
-            auto HandleBatch = [&](int index) {
-                auto start_load2_mem = std::chrono::system_clock::now();
-                auto batch_data = file_manager_->LoadIndexToMemory(batch);
-                load_duration_sum +=
-                    (std::chrono::system_clock::now() - start_load2_mem);
-                for (int j = index - batch.size() + 1; j <= index; j++) {
-                    std::string file_name = GenSlicedFileName(prefix, j);
-                    AssertInfo(batch_data.find(file_name) != batch_data.end(),
-                               "lost index slice data");
-                    auto data = batch_data[file_name];
-                    auto start_write_file = std::chrono::system_clock::now();
-                    auto written = file.Write(data->Data(), data->Size());
-                    write_disk_duration_sum +=
-                        (std::chrono::system_clock::now() - start_write_file);
-                    AssertInfo(
-                        written == data->Size(),
-                        fmt::format("failed to write index data to disk {}: {}",
-                                    filepath->data(),
-                                    strerror(errno)));
-                }
-                for (auto& file : batch) {
-                    pending_index_files.erase(file);
-                }
-                batch.clear();
-            };
-
+            std::vector<std::string> slices;
+            slices.reserve(slice_num);
             for (auto i = 0; i < slice_num; ++i) {
                 std::string file_name = GenSlicedFileName(prefix, i);
-                batch.push_back(index_file_prefix + file_name);
-                if (batch.size() >= parallel_degree) {
-                    HandleBatch(i);
-                }
+                slices.push_back(index_file_prefix + file_name);
             }
-            if (batch.size() > 0) {
-                HandleBatch(slice_num - 1);
+            file_offset =
+                storage::DownloadToFile(file_manager_->GetChunkManager().get(),
+                                        slices,
+                                        file,
+                                        file_offset,
+                                        parallel_degree,
+                                        stats);
+            for (auto& slice : slices) {
+                pending_index_files.erase(slice);
             }
         }
     } else {
-        //1. load files into memory
-        auto start_load_files2_mem = std::chrono::system_clock::now();
-        auto result = file_manager_->LoadIndexToMemory(std::vector<std::string>(
-            pending_index_files.begin(), pending_index_files.end()));
-        load_duration_sum +=
-            (std::chrono::system_clock::now() - start_load_files2_mem);
-        //2. write data into files
-        auto start_write_file = std::chrono::system_clock::now();
-        for (auto& [_, index_data] : result) {
-            file.Write(index_data->Data(), index_data->Size());
-        }
-        write_disk_duration_sum +=
-            (std::chrono::system_clock::now() - start_write_file);
+        // write in the order of file name, same as LoadIndexToMemory
+        std::vector<std::string> files(pending_index_files.begin(),
+                                       pending_index_files.end());
+        std::sort(files.begin(),
+                  files.end(),
+                  [](const std::string& a, const std::string& b) {
+                      return a.substr(a.find_last_of('/') + 1) <
+                             b.substr(b.find_last_of('/') + 1);
+                  });
+        file_offset =
+            storage::DownloadToFile(file_manager_->GetChunkManager().get(),
+                                    files,
+                                    file,
+                                    file_offset,
+                                    parallel_degree,
+                                    stats);
     }
+    auto load_duration_sum = stats.download_duration;
+    auto write_disk_duration_sum = stats.write_duration;
+    LOG_INFO("download index files to {} done, stats: {}",
+             filepath.value(),
+             stats.ToString());
     milvus::monitor::internal_storage_download_duration.Observe(
         std::chrono::duration_cast<std::chrono::milliseconds>(load_duration_sum)
             .count());
@@ -60,6 +60,7 @@ class IndexFactory {
             case DataType::VARCHAR:
             case DataType::STRING:
             case DataType::ARRAY:
+            case DataType::JSON:
                 return CreateScalarIndex(type, config, context);
 
             case DataType::VECTOR_FLOAT:
@@ -32,6 +32,12 @@ ScalarIndexCreator::ScalarIndexCreator(
     }
     index_info.field_type = dtype_;
     index_info.index_type = index_type();
+    if (dtype_ == DataType::JSON) {
+        index_info.json_path =
+            index::GetValueFromConfig<std::string>(config, index::JSON_PATH)
+                .value_or("");
+        index_info.json_cast_type = index::GetJsonCastTypeFromConfig(config);
+    }
     index_ = index::IndexFactory::GetInstance().CreateIndex(
         index_info, file_manager_context);
 }
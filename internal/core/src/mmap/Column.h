@@ -359,6 +359,36 @@ class ColumnBase {
         num_rows_++;
     }
 
+    // Claim the first num_rows rows of the pre-sized buffer so that loaders
+    // can decode binlogs straight into MutableData/MutableValidData instead
+    // of appending FieldData batches.
+    void
+    ResizeForInPlaceLoad(size_t num_rows) {
+        AssertInfo(mapping_type_ == MappingType::MAP_WITH_ANONYMOUS,
+                   "in place load only use in anonymous mapping");
+        size_t required_size = num_rows * type_size_;
+        AssertInfo(required_size <= data_cap_size_,
+                   "in place load exceeds the column capacity, required {}, "
+                   "capacity {}",
+                   required_size,
+                   data_cap_size_);
+        data_size_ = required_size;
+        if (nullable_) {
+            valid_data_.resize(num_rows);
+        }
+        num_rows_ = num_rows;
+    }
+
+    char*
+    MutableData() {
+        return data_;
+    }
+
+    bool*
+    MutableValidData() {
+        return nullable_ ? valid_data_.data() : nullptr;
+    }
+
     void
     SetPaddingSize(const DataType& type) {
         padding_ = PaddingSize(type);
@@ -158,6 +158,10 @@ std::map<std::string, std::string> writeDiskDurationLabels{
     {"type", "write_disk"}};
 std::map<std::string, std::string> deserializeDurationLabels{
     {"type", "deserialize"}};
+std::map<std::string, std::string> queueWaitDurationLabels{
+    {"type", "queue_wait"}};
+std::map<std::string, std::string> fieldDataInflightLabels{
+    {"type", "field_data"}};
 DEFINE_PROMETHEUS_HISTOGRAM_FAMILY(internal_storage_load_duration,
                                    "[cpp]durations of load segment")
 DEFINE_PROMETHEUS_HISTOGRAM(internal_storage_download_duration,
@@ -169,6 +173,15 @@ DEFINE_PROMETHEUS_HISTOGRAM(internal_storage_write_disk_duration,
 DEFINE_PROMETHEUS_HISTOGRAM(internal_storage_deserialize_duration,
                             internal_storage_load_duration,
                             deserializeDurationLabels)
+DEFINE_PROMETHEUS_HISTOGRAM(internal_storage_queue_wait_duration,
+                            internal_storage_load_duration,
+                            queueWaitDurationLabels)
+DEFINE_PROMETHEUS_GAUGE_FAMILY(
+    internal_storage_load_inflight_bytes,
+    "[cpp]bytes of loaded binlogs not yet consumed by segment")
+DEFINE_PROMETHEUS_GAUGE(internal_storage_load_inflight_bytes_field_data,
+                        internal_storage_load_inflight_bytes,
+                        fieldDataInflightLabels)
 
 // search latency metrics
 std::map<std::string, std::string> scalarLatencyLabels{
@@ -218,4 +231,62 @@ DEFINE_PROMETHEUS_GAUGE(internal_mmap_in_used_space_bytes_anon,
 DEFINE_PROMETHEUS_GAUGE(internal_mmap_in_used_space_bytes_file,
                         internal_mmap_in_used_space_bytes,
                         mmapAllocatedSpaceFileLabel)
+
+// chunk cache metrics
+std::map<std::string, std::string> chunkCacheHitLabel = {{"type", "hit"}};
+std::map<std::string, std::string> chunkCacheMissLabel = {{"type", "miss"}};
+std::map<std::string, std::string> chunkCacheEvictLabel = {{"type", "evict"}};
+std::map<std::string, std::string> chunkCacheAllLabel = {{"type", "all"}};
+
+DEFINE_PROMETHEUS_COUNTER_FAMILY(internal_chunk_cache_op_count,
+                                 "[cpp]count of chunk cache operation")
+DEFINE_PROMETHEUS_COUNTER(internal_chunk_cache_op_count_hit,
+                          internal_chunk_cache_op_count,
+                          chunkCacheHitLabel)
+DEFINE_PROMETHEUS_COUNTER(internal_chunk_cache_op_count_miss,
+                          internal_chunk_cache_op_count,
+                          chunkCacheMissLabel)
+DEFINE_PROMETHEUS_COUNTER(internal_chunk_cache_op_count_evict,
+                          internal_chunk_cache_op_count,
+                          chunkCacheEvictLabel)
+
+DEFINE_PROMETHEUS_GAUGE_FAMILY(internal_chunk_cache_cached_bytes,
+                               "[cpp]bytes of columns cached by chunk cache")
+DEFINE_PROMETHEUS_GAUGE(internal_chunk_cache_cached_bytes_all,
+                        internal_chunk_cache_cached_bytes,
+                        chunkCacheAllLabel)
+
+// deleted bitmap cache metrics
+std::map<std::string, std::string> deletedBitmapCacheHitLabel = {
+    {"type", "hit"}};
+std::map<std::string, std::string> deletedBitmapCacheMissLabel = {
+    {"type", "miss"}};
+
+DEFINE_PROMETHEUS_COUNTER_FAMILY(internal_deleted_bitmap_cache_op_count,
+                                 "[cpp]count of deleted bitmap cache lookups")
+DEFINE_PROMETHEUS_COUNTER(internal_deleted_bitmap_cache_op_count_hit,
+                          internal_deleted_bitmap_cache_op_count,
+                          deletedBitmapCacheHitLabel)
+DEFINE_PROMETHEUS_COUNTER(internal_deleted_bitmap_cache_op_count_miss,
+                          internal_deleted_bitmap_cache_op_count,
+                          deletedBitmapCacheMissLabel)
+
+// expr result cache metrics
+std::map<std::string, std::string> exprResultCacheHitLabel = {{"type", "hit"}};
+std::map<std::string, std::string> exprResultCacheMissLabel = {
+    {"type", "miss"}};
+std::map<std::string, std::string> exprResultCacheEvictLabel = {
+    {"type", "evict"}};
+
+DEFINE_PROMETHEUS_COUNTER_FAMILY(internal_expr_result_cache_op_count,
+                                 "[cpp]count of expr result cache operation")
+DEFINE_PROMETHEUS_COUNTER(internal_expr_result_cache_op_count_hit,
+                          internal_expr_result_cache_op_count,
+                          exprResultCacheHitLabel)
+DEFINE_PROMETHEUS_COUNTER(internal_expr_result_cache_op_count_miss,
+                          internal_expr_result_cache_op_count,
+                          exprResultCacheMissLabel)
+DEFINE_PROMETHEUS_COUNTER(internal_expr_result_cache_op_count_evict,
+                          internal_expr_result_cache_op_count,
+                          exprResultCacheEvictLabel)
 }  // namespace milvus::monitor
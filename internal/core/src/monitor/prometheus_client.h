@@ -119,6 +119,9 @@ DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_storage_load_duration);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_storage_download_duration);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_storage_write_disk_duration);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_storage_deserialize_duration);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_storage_queue_wait_duration);
+DECLARE_PROMETHEUS_GAUGE_FAMILY(internal_storage_load_inflight_bytes);
+DECLARE_PROMETHEUS_GAUGE(internal_storage_load_inflight_bytes_field_data);
 
 // mmap metrics
 DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_mmap_allocated_space_bytes);
@@ -128,6 +131,25 @@ DECLARE_PROMETHEUS_GAUGE_FAMILY(internal_mmap_in_used_space_bytes);
 DECLARE_PROMETHEUS_GAUGE(internal_mmap_in_used_space_bytes_anon);
 DECLARE_PROMETHEUS_GAUGE(internal_mmap_in_used_space_bytes_file);
 
+// chunk cache metrics
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_chunk_cache_op_count);
+DECLARE_PROMETHEUS_COUNTER(internal_chunk_cache_op_count_hit);
+DECLARE_PROMETHEUS_COUNTER(internal_chunk_cache_op_count_miss);
+DECLARE_PROMETHEUS_COUNTER(internal_chunk_cache_op_count_evict);
+DECLARE_PROMETHEUS_GAUGE_FAMILY(internal_chunk_cache_cached_bytes);
+DECLARE_PROMETHEUS_GAUGE(internal_chunk_cache_cached_bytes_all);
+
+// deleted bitmap cache metrics
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_deleted_bitmap_cache_op_count);
+DECLARE_PROMETHEUS_COUNTER(internal_deleted_bitmap_cache_op_count_hit);
+DECLARE_PROMETHEUS_COUNTER(internal_deleted_bitmap_cache_op_count_miss);
+
+// expr result cache metrics
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_expr_result_cache_op_count);
+DECLARE_PROMETHEUS_COUNTER(internal_expr_result_cache_op_count_hit);
+DECLARE_PROMETHEUS_COUNTER(internal_expr_result_cache_op_count_miss);
+DECLARE_PROMETHEUS_COUNTER(internal_expr_result_cache_op_count_evict);
+
 // search metrics
 DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_core_search_latency);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_core_search_latency_scalar);
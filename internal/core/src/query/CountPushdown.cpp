@@ -0,0 +1,232 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "query/CountPushdown.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "exec/expression/Utils.h"
+#include "index/ScalarIndex.h"
+#include "query/Utils.h"
+
+namespace milvus::query {
+
+namespace {
+
+template <typename T>
+bool
+ValueCaseMatches(const proto::plan::GenericValue& value) {
+    using GenericValue = proto::plan::GenericValue;
+    if constexpr (std::is_same_v<T, bool>) {
+        return value.val_case() == GenericValue::kBoolVal;
+    } else if constexpr (std::is_integral_v<T>) {
+        return value.val_case() == GenericValue::kInt64Val;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return value.val_case() == GenericValue::kFloatVal;
+    } else {
+        return value.val_case() == GenericValue::kStringVal;
+    }
+}
+
+// the scalar index of the field, if it covers exactly the rows being counted.
+template <typename T>
+const index::ScalarIndex<T>*
+CountableIndex(const segcore::SegmentInternalInterface& segment,
+               FieldId field_id,
+               int64_t active_count) {
+    if (!segment.HasIndex(field_id) || segment.num_chunk_index(field_id) != 1) {
+        return nullptr;
+    }
+    // the index is built over the whole segment, rows past the active range
+    // would have to be excluded one by one.
+    if (active_count != segment.get_row_count()) {
+        return nullptr;
+    }
+    return &segment.chunk_scalar_index<T>(field_id, 0);
+}
+
+bool
+IsCountableRangeOp(proto::plan::OpType op) {
+    switch (op) {
+        case proto::plan::OpType::GreaterThan:
+        case proto::plan::OpType::GreaterEqual:
+        case proto::plan::OpType::LessThan:
+        case proto::plan::OpType::LessEqual:
+        case proto::plan::OpType::Equal:
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <typename T>
+std::optional<int64_t>
+CountUnaryRange(const segcore::SegmentInternalInterface& segment,
+                const expr::UnaryRangeFilterExpr& expr,
+                int64_t active_count,
+                Timestamp timestamp) {
+    if (!ValueCaseMatches<T>(expr.val_)) {
+        return std::nullopt;
+    }
+    bool overflowed = false;
+    auto val = exec::GetValueFromProtoWithOverflow<T>(expr.val_, overflowed);
+    if (overflowed) {
+        return std::nullopt;
+    }
+    auto field_id = expr.column_.field_id_;
+
+    // min/max of every chunk rule the value out, nothing can match.
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        auto num_data_chunk = segment.num_chunk_data(field_id);
+        auto& skip_index = segment.GetSkipIndex();
+        bool all_skipped = num_data_chunk > 0;
+        for (int64_t i = 0; all_skipped && i < num_data_chunk; ++i) {
+            all_skipped = skip_index.CanSkipUnaryRange<T>(
+                field_id, i, expr.op_type_, val);
+        }
+        if (all_skipped) {
+            return 0;
+        }
+    }
+
+    auto index = CountableIndex<T>(segment, field_id, active_count);
+    if (index == nullptr) {
+        return std::nullopt;
+    }
+    auto excluded = segment.get_masked_offsets(active_count, timestamp);
+    if (expr.op_type_ == proto::plan::OpType::Equal) {
+        return index->CountIn(1, &val, excluded);
+    }
+    return index->CountRange(val, expr.op_type_, excluded);
+}
+
+template <typename T>
+std::optional<int64_t>
+CountTerm(const segcore::SegmentInternalInterface& segment,
+          const expr::TermFilterExpr& expr,
+          int64_t active_count,
+          Timestamp timestamp) {
+    auto index =
+        CountableIndex<T>(segment, expr.column_.field_id_, active_count);
+    if (index == nullptr) {
+        return std::nullopt;
+    }
+    std::vector<T> values;
+    values.reserve(expr.vals_.size());
+    for (const auto& value : expr.vals_) {
+        if (!ValueCaseMatches<T>(value)) {
+            return std::nullopt;
+        }
+        bool overflowed = false;
+        auto converted =
+            exec::GetValueFromProtoWithOverflow<T>(value, overflowed);
+        // a value the column can't hold matches no row.
+        if (!overflowed) {
+            values.emplace_back(std::move(converted));
+        }
+    }
+    if (values.empty()) {
+        return 0;
+    }
+    auto excluded = segment.get_masked_offsets(active_count, timestamp);
+    return index->CountIn(values.size(), values.data(), excluded);
+}
+
+template <template <typename> class Visitor, typename... Args>
+std::optional<int64_t>
+DispatchScalar(DataType data_type, Args&&... args) {
+    switch (data_type) {
+        case DataType::BOOL:
+            return Visitor<bool>::Count(std::forward<Args>(args)...);
+        case DataType::INT8:
+            return Visitor<int8_t>::Count(std::forward<Args>(args)...);
+        case DataType::INT16:
+            return Visitor<int16_t>::Count(std::forward<Args>(args)...);
+        case DataType::INT32:
+            return Visitor<int32_t>::Count(std::forward<Args>(args)...);
+        case DataType::INT64:
+            return Visitor<int64_t>::Count(std::forward<Args>(args)...);
+        case DataType::FLOAT:
+            return Visitor<float>::Count(std::forward<Args>(args)...);
+        case DataType::DOUBLE:
+            return Visitor<double>::Count(std::forward<Args>(args)...);
+        case DataType::VARCHAR:
+            return Visitor<std::string>::Count(std::forward<Args>(args)...);
+        default:
+            return std::nullopt;
+    }
+}
+
+template <typename T>
+struct UnaryRangeCounter {
+    template <typename... Args>
+    static std::optional<int64_t>
+    Count(Args&&... args) {
+        return CountUnaryRange<T>(std::forward<Args>(args)...);
+    }
+};
+
+template <typename T>
+struct TermCounter {
+    template <typename... Args>
+    static std::optional<int64_t>
+    Count(Args&&... args) {
+        return CountTerm<T>(std::forward<Args>(args)...);
+    }
+};
+
+}  // namespace
+
+std::optional<int64_t>
+TryCountWithoutBitset(const segcore::SegmentInternalInterface& segment,
+                      const expr::TypedExprPtr& filter,
+                      int64_t active_count,
+                      Timestamp timestamp) {
+    if (filter == nullptr ||
+        std::dynamic_pointer_cast<const expr::AlwaysTrueExpr>(filter)) {
+        return active_count -
+               segment.get_masked_count(active_count, timestamp);
+    }
+
+    if (auto unary =
+            std::dynamic_pointer_cast<const expr::UnaryRangeFilterExpr>(
+                filter)) {
+        if (!unary->column_.nested_path_.empty() ||
+            !IsCountableRangeOp(unary->op_type_)) {
+            return std::nullopt;
+        }
+        return DispatchScalar<UnaryRangeCounter>(unary->column_.data_type_,
+                                                 segment,
+                                                 *unary,
+                                                 active_count,
+                                                 timestamp);
+    }
+
+    if (auto term =
+            std::dynamic_pointer_cast<const expr::TermFilterExpr>(filter)) {
+        if (term->is_in_field_ || !term->column_.nested_path_.empty()) {
+            return std::nullopt;
+        }
+        return DispatchScalar<TermCounter>(term->column_.data_type_,
+                                           segment,
+                                           *term,
+                                           active_count,
+                                           timestamp);
+    }
+
+    return std::nullopt;
+}
+
+}  // namespace milvus::query
@@ -0,0 +1,34 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <optional>
+
+#include "common/Types.h"
+#include "expr/ITypeExpr.h"
+#include "segcore/SegmentInterface.h"
+
+namespace milvus::query {
+
+// Answer count(*) for `filter` (nullptr means no filter) over the first
+// `active_count` rows of the segment without building a bitset. Deleted
+// rows and rows not visible at `timestamp` are excluded. Returns
+// std::nullopt if the filter can't be counted from scalar indexes or
+// skip-index statistics, in which case the caller falls back to the
+// bitset path.
+std::optional<int64_t>
+TryCountWithoutBitset(const segcore::SegmentInternalInterface& segment,
+                      const expr::TypedExprPtr& filter,
+                      int64_t active_count,
+                      Timestamp timestamp);
+
+}  // namespace milvus::query
@@ -9,16 +9,70 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <algorithm>
+#include <optional>
+#include <vector>
+
 #include "common/BitsetView.h"
 #include "common/QueryInfo.h"
 #include "common/Tracer.h"
 #include "common/Types.h"
+#include "futures/Executor.h"
 #include "SearchOnGrowing.h"
 #include "query/SearchBruteForce.h"
 #include "query/SearchOnIndex.h"
+#include "segcore/SegcoreConfig.h"
 
 namespace milvus::query {
 
+namespace {
+
+// Searches chunks [0, num_chunks) with at most `parallelism` workers and
+// merges the results in one k-way pass. Every task searches a contiguous run
+// of chunks and merges them in order, the runs are then merged in order too,
+// so ties come out in chunk order exactly like the serial fold.
+template <typename SearchChunk>
+void
+ParallelSearchChunks(int64_t num_chunks,
+                     int64_t parallelism,
+                     const SearchChunk& search_chunk,
+                     SubSearchResult& final_qr) {
+    auto num_tasks = std::max<int64_t>(1, std::min(parallelism, num_chunks));
+    if (num_tasks == 1) {
+        for (int64_t chunk_id = 0; chunk_id < num_chunks; ++chunk_id) {
+            final_qr.merge(search_chunk(chunk_id));
+        }
+        return;
+    }
+
+    std::vector<std::optional<SubSearchResult>> results(num_tasks);
+    milvus::futures::ParallelForEach(
+        num_tasks, num_tasks, [&](int64_t task_id) {
+            auto begin = num_chunks * task_id / num_tasks;
+            auto end = num_chunks * (task_id + 1) / num_tasks;
+            auto& result = results[task_id];
+            for (auto chunk_id = begin; chunk_id < end; ++chunk_id) {
+                auto sub_qr = search_chunk(chunk_id);
+                if (result.has_value()) {
+                    result->merge(sub_qr);
+                } else {
+                    result.emplace(std::move(sub_qr));
+                }
+            }
+        });
+
+    std::vector<const SubSearchResult*> sources;
+    sources.reserve(num_tasks);
+    for (auto& result : results) {
+        if (result.has_value()) {
+            sources.push_back(&result.value());
+        }
+    }
+    final_qr.merge(sources);
+}
+
+}  // namespace
+
 void
 FloatSegmentIndexSearch(const segcore::SegmentGrowingImpl& segment,
                         const SearchInfo& info,
@@ -109,17 +163,18 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
         auto vec_size_per_chunk = vec_ptr->get_size_per_chunk();
         auto max_chunk = upper_div(active_count, vec_size_per_chunk);
 
-        for (int chunk_id = current_chunk_id; chunk_id < max_chunk;
-             ++chunk_id) {
-            auto chunk_data = vec_ptr->get_chunk_data(chunk_id);
+        if (info.group_by_field_id_.has_value()) {
+            // chunk iterators are assembled by chunk id, keep them in order
+            for (int chunk_id = current_chunk_id; chunk_id < max_chunk;
+                 ++chunk_id) {
+                auto chunk_data = vec_ptr->get_chunk_data(chunk_id);
 
-            auto element_begin = chunk_id * vec_size_per_chunk;
-            auto element_end =
-                std::min(active_count, (chunk_id + 1) * vec_size_per_chunk);
-            auto size_per_chunk = element_end - element_begin;
+                auto element_begin = chunk_id * vec_size_per_chunk;
+                auto element_end = std::min(
+                    active_count, (chunk_id + 1) * vec_size_per_chunk);
+                auto size_per_chunk = element_end - element_begin;
 
-            auto sub_view = bitset.subview(element_begin, size_per_chunk);
-            if (info.group_by_field_id_.has_value()) {
+                auto sub_view = bitset.subview(element_begin, size_per_chunk);
                 auto sub_qr = BruteForceSearchIterators(search_dataset,
                                                         chunk_data,
                                                         size_per_chunk,
@@ -127,7 +182,17 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                                                         sub_view,
                                                         data_type);
                 final_qr.merge(sub_qr);
-            } else {
+            }
+        } else {
+            auto search_chunk = [&](int64_t chunk_id) {
+                auto chunk_data = vec_ptr->get_chunk_data(chunk_id);
+
+                auto element_begin = chunk_id * vec_size_per_chunk;
+                auto element_end = std::min(
+                    active_count, (chunk_id + 1) * vec_size_per_chunk);
+                auto size_per_chunk = element_end - element_begin;
+
+                auto sub_view = bitset.subview(element_begin, size_per_chunk);
                 auto sub_qr = BruteForceSearch(search_dataset,
                                                chunk_data,
                                                size_per_chunk,
@@ -138,11 +203,15 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                 // convert chunk uid to segment uid
                 for (auto& x : sub_qr.mutable_seg_offsets()) {
                     if (x != -1) {
-                        x += chunk_id * vec_size_per_chunk;
+                        x += element_begin;
                     }
                 }
-                final_qr.merge(sub_qr);
-            }
+                return sub_qr;
+            };
+            auto parallelism = segcore::SegcoreConfig::default_config()
+                                   .get_growing_search_parallelism();
+            ParallelSearchChunks(
+                max_chunk, parallelism, search_chunk, final_qr);
         }
         if (info.group_by_field_id_.has_value()) {
             search_result.AssembleChunkVectorIterators(
@@ -9,6 +9,7 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <algorithm>
 #include <cmath>
 
 #include "common/EasyAssert.h"
@@ -16,6 +17,37 @@
 
 namespace milvus::query {
 
+namespace {
+
+// Scratch buffers shared by all merges on a thread, so merging results does
+// not allocate once the buffers have grown to the largest topk seen.
+struct MergeScratch {
+    std::vector<float> distances;
+    std::vector<int64_t> seg_offsets;
+    std::vector<int64_t> cursors;
+    std::vector<int64_t> heap;
+
+    void
+    reserve(int64_t topk, int64_t num_sources) {
+        if (distances.size() < static_cast<size_t>(topk)) {
+            distances.resize(topk);
+            seg_offsets.resize(topk);
+        }
+        if (cursors.size() < static_cast<size_t>(num_sources)) {
+            cursors.resize(num_sources);
+            heap.reserve(num_sources);
+        }
+    }
+};
+
+MergeScratch&
+GetMergeScratch() {
+    thread_local MergeScratch scratch;
+    return scratch;
+}
+
+}  // namespace
+
 template <bool is_desc>
 void
 SubSearchResult::merge_impl(const SubSearchResult& right) {
@@ -27,6 +59,11 @@ SubSearchResult::merge_impl(const SubSearchResult& right) {
     AssertInfo(is_desc == PositivelyRelated(metric_type_),
                "[SubSearchResult]Metric type isn't desc");
 
+    auto& scratch = GetMergeScratch();
+    scratch.reserve(topk_, 2);
+    float* __restrict__ buf_distances = scratch.distances.data();
+    int64_t* __restrict__ buf_ids = scratch.seg_offsets.data();
+
     for (int64_t qn = 0; qn < num_queries_; ++qn) {
         auto offset = qn * topk_;
 
@@ -36,9 +73,6 @@ SubSearchResult::merge_impl(const SubSearchResult& right) {
         auto right_ids = right.get_ids() + offset;
         auto right_distances = right.get_distances() + offset;
 
-        std::vector<float> buf_distances(topk_);
-        std::vector<int64_t> buf_ids(topk_);
-
         auto lit = 0;  // left iter
         auto rit = 0;  // right iter
 
@@ -68,8 +102,91 @@ SubSearchResult::merge_impl(const SubSearchResult& right) {
                 }
             }
         }
-        std::copy_n(buf_distances.data(), topk_, left_distances);
-        std::copy_n(buf_ids.data(), topk_, left_ids);
+        std::copy_n(buf_distances, topk_, left_distances);
+        std::copy_n(buf_ids, topk_, left_ids);
+    }
+}
+
+// `sources[0]` must be this result. Every source is sorted per query and
+// padded with INVALID_SEG_OFFSET, so a source is drained at its first
+// invalid id. Ties go to the lower source index, which matches folding the
+// sources in order with the pairwise merge.
+template <bool is_desc>
+void
+SubSearchResult::merge_impl(const std::vector<const SubSearchResult*>& sources) {
+    AssertInfo(is_desc == PositivelyRelated(metric_type_),
+               "[SubSearchResult]Metric type isn't desc");
+    auto num_sources = static_cast<int64_t>(sources.size());
+    auto& scratch = GetMergeScratch();
+    scratch.reserve(topk_, num_sources);
+    float* __restrict__ buf_distances = scratch.distances.data();
+    int64_t* __restrict__ buf_ids = scratch.seg_offsets.data();
+    auto invalid_distance = init_value(metric_type_);
+
+    for (int64_t qn = 0; qn < num_queries_; ++qn) {
+        auto offset = qn * topk_;
+
+        if (topk_ == 1) {
+            // a single slot per query needs no heap, just the best head
+            int64_t best_id = INVALID_SEG_OFFSET;
+            float best_v = invalid_distance;
+            for (auto source : sources) {
+                auto id = source->get_ids()[offset];
+                auto v = source->get_distances()[offset];
+                bool better = is_desc ? (v > best_v) : (v < best_v);
+                if (id != INVALID_SEG_OFFSET &&
+                    (best_id == INVALID_SEG_OFFSET || better)) {
+                    best_id = id;
+                    best_v = v;
+                }
+            }
+            buf_ids[0] = best_id;
+            buf_distances[0] = best_v;
+        } else {
+            auto* cursors = scratch.cursors.data();
+            auto& heap = scratch.heap;
+            heap.clear();
+            auto head_distance = [&](int64_t s) {
+                return sources[s]->get_distances()[offset + cursors[s]];
+            };
+            // heap order: true when source `a` should come out after `b`
+            auto after = [&](int64_t a, int64_t b) {
+                auto a_v = head_distance(a);
+                auto b_v = head_distance(b);
+                if (a_v != b_v) {
+                    return is_desc ? (a_v < b_v) : (a_v > b_v);
+                }
+                return a > b;
+            };
+            for (int64_t s = 0; s < num_sources; ++s) {
+                cursors[s] = 0;
+                if (sources[s]->get_ids()[offset] != INVALID_SEG_OFFSET) {
+                    heap.push_back(s);
+                }
+            }
+            std::make_heap(heap.begin(), heap.end(), after);
+
+            int64_t buf_iter = 0;
+            for (; buf_iter < topk_ && !heap.empty(); ++buf_iter) {
+                std::pop_heap(heap.begin(), heap.end(), after);
+                auto s = heap.back();
+                auto pos = offset + cursors[s];
+                buf_distances[buf_iter] = sources[s]->get_distances()[pos];
+                buf_ids[buf_iter] = sources[s]->get_ids()[pos];
+                if (++cursors[s] < topk_ &&
+                    sources[s]->get_ids()[pos + 1] != INVALID_SEG_OFFSET) {
+                    std::push_heap(heap.begin(), heap.end(), after);
+                } else {
+                    heap.pop_back();
+                }
+            }
+            std::fill(buf_distances + buf_iter,
+                      buf_distances + topk_,
+                      invalid_distance);
+            std::fill(buf_ids + buf_iter, buf_ids + topk_, INVALID_SEG_OFFSET);
+        }
+        std::copy_n(buf_distances, topk_, this->get_distances() + offset);
+        std::copy_n(buf_ids, topk_, this->get_seg_offsets() + offset);
     }
 }
 
@@ -78,9 +195,9 @@ SubSearchResult::merge(const SubSearchResult& other) {
     AssertInfo(metric_type_ == other.metric_type_,
                "[SubSearchResult]Metric type check failed when merge");
     if (!other.chunk_iterators_.empty()) {
-        std::move(std::begin(other.chunk_iterators_),
-                  std::end(other.chunk_iterators_),
-                  std::back_inserter(this->chunk_iterators_));
+        this->chunk_iterators_.insert(this->chunk_iterators_.end(),
+                                      other.chunk_iterators_.begin(),
+                                      other.chunk_iterators_.end());
     } else {
         if (PositivelyRelated(metric_type_)) {
             this->merge_impl<true>(other);
@@ -90,6 +207,35 @@ SubSearchResult::merge(const SubSearchResult& other) {
     }
 }
 
+void
+SubSearchResult::merge(const std::vector<const SubSearchResult*>& others) {
+    std::vector<const SubSearchResult*> sources{this};
+    sources.reserve(others.size() + 1);
+    for (auto other : others) {
+        AssertInfo(metric_type_ == other->metric_type_,
+                   "[SubSearchResult]Metric type check failed when merge");
+        if (!other->chunk_iterators_.empty()) {
+            this->chunk_iterators_.insert(this->chunk_iterators_.end(),
+                                          other->chunk_iterators_.begin(),
+                                          other->chunk_iterators_.end());
+            continue;
+        }
+        AssertInfo(num_queries_ == other->num_queries_,
+                   "[SubSearchResult]Nq check failed");
+        AssertInfo(topk_ == other->topk_,
+                   "[SubSearchResult]Topk check failed");
+        sources.push_back(other);
+    }
+    if (sources.size() == 1) {
+        return;
+    }
+    if (PositivelyRelated(metric_type_)) {
+        this->merge_impl<true>(sources);
+    } else {
+        this->merge_impl<false>(sources);
+    }
+}
+
 void
 SubSearchResult::round_values() {
     if (round_decimal_ == -1)
@@ -111,6 +111,11 @@ class SubSearchResult {
     void
     merge(const SubSearchResult& other);
 
+    // Merges every result in `others` into this one with a single k-way
+    // pass per query, instead of folding them in one by one.
+    void
+    merge(const std::vector<const SubSearchResult*>& others);
+
     const std::vector<knowhere::IndexNode::IteratorPtr>&
     chunk_iterators() {
         return this->chunk_iterators_;
@@ -121,6 +126,10 @@ class SubSearchResult {
     void
     merge_impl(const SubSearchResult& sub_result);
 
+    template <bool is_desc>
+    void
+    merge_impl(const std::vector<const SubSearchResult*>& sources);
+
  private:
     int64_t num_queries_;
     int64_t topk_;
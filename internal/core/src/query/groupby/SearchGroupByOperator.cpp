@@ -15,12 +15,27 @@
 // limitations under the License.
 #include "SearchGroupByOperator.h"
 #include "common/Consts.h"
+#include "futures/Executor.h"
+#include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentSealedImpl.h"
 #include "query/Utils.h"
 
 namespace milvus {
 namespace query {
 
+namespace {
+
+// rows pulled from an iterator before their group keys are resolved
+constexpr int64_t GROUP_BY_BATCH_SIZE = 64;
+
+struct GroupByQueryResult {
+    std::vector<int64_t> offsets;
+    std::vector<float> distances;
+    std::vector<GroupByValueType> group_by_values;
+};
+
+}  // namespace
+
 void
 SearchGroupBy(const std::vector<std::shared_ptr<VectorIterator>>& iterators,
               const SearchInfo& search_info,
@@ -40,90 +55,62 @@ SearchGroupBy(const std::vector<std::shared_ptr<VectorIterator>>& iterators,
     topk_per_nq_prefix_sum.reserve(iterators.size() + 1);
     switch (data_type) {
         case DataType::INT8: {
-            auto dataGetter = GetDataGetter<int8_t>(segment, group_by_field_id);
             GroupIteratorsByType<int8_t>(iterators,
-                                         search_info.topk_,
-                                         search_info.group_size_,
-                                         search_info.group_strict_size_,
-                                         *dataGetter,
+                                         search_info,
+                                         segment,
                                          group_by_values,
                                          seg_offsets,
                                          distances,
-                                         search_info.metric_type_,
                                          topk_per_nq_prefix_sum);
             break;
         }
         case DataType::INT16: {
-            auto dataGetter =
-                GetDataGetter<int16_t>(segment, group_by_field_id);
             GroupIteratorsByType<int16_t>(iterators,
-                                          search_info.topk_,
-                                          search_info.group_size_,
-                                          search_info.group_strict_size_,
-                                          *dataGetter,
+                                          search_info,
+                                          segment,
                                           group_by_values,
                                           seg_offsets,
                                           distances,
-                                          search_info.metric_type_,
                                           topk_per_nq_prefix_sum);
             break;
         }
         case DataType::INT32: {
-            auto dataGetter =
-                GetDataGetter<int32_t>(segment, group_by_field_id);
             GroupIteratorsByType<int32_t>(iterators,
-                                          search_info.topk_,
-                                          search_info.group_size_,
-                                          search_info.group_strict_size_,
-                                          *dataGetter,
+                                          search_info,
+                                          segment,
                                           group_by_values,
                                           seg_offsets,
                                           distances,
-                                          search_info.metric_type_,
                                           topk_per_nq_prefix_sum);
             break;
         }
         case DataType::INT64: {
-            auto dataGetter =
-                GetDataGetter<int64_t>(segment, group_by_field_id);
             GroupIteratorsByType<int64_t>(iterators,
-                                          search_info.topk_,
-                                          search_info.group_size_,
-                                          search_info.group_strict_size_,
-                                          *dataGetter,
+                                          search_info,
+                                          segment,
                                           group_by_values,
                                           seg_offsets,
                                           distances,
-                                          search_info.metric_type_,
                                           topk_per_nq_prefix_sum);
             break;
         }
         case DataType::BOOL: {
-            auto dataGetter = GetDataGetter<bool>(segment, group_by_field_id);
             GroupIteratorsByType<bool>(iterators,
-                                       search_info.topk_,
-                                       search_info.group_size_,
-                                       search_info.group_strict_size_,
-                                       *dataGetter,
+                                       search_info,
+                                       segment,
                                        group_by_values,
                                        seg_offsets,
                                        distances,
-                                       search_info.metric_type_,
                                        topk_per_nq_prefix_sum);
             break;
         }
         case DataType::VARCHAR: {
-            auto dataGetter =
-                GetDataGetter<std::string>(segment, group_by_field_id);
             GroupIteratorsByType<std::string>(iterators,
-                                              search_info.topk_,
-                                              search_info.group_size_,
-                                              search_info.group_strict_size_,
-                                              *dataGetter,
+                                              search_info,
+                                              segment,
                                               group_by_values,
                                               seg_offsets,
                                               distances,
-                                              search_info.metric_type_,
                                               topk_per_nq_prefix_sum);
             break;
         }
@@ -140,59 +127,95 @@ template <typename T>
 void
 GroupIteratorsByType(
     const std::vector<std::shared_ptr<VectorIterator>>& iterators,
-    int64_t topK,
-    int64_t group_size,
-    bool group_strict_size,
-    const DataGetter<T>& data_getter,
+    const SearchInfo& search_info,
+    const segcore::SegmentInternalInterface& segment,
     std::vector<GroupByValueType>& group_by_values,
     std::vector<int64_t>& seg_offsets,
     std::vector<float>& distances,
-    const knowhere::MetricType& metrics_type,
     std::vector<size_t>& topk_per_nq_prefix_sum) {
+    // every query walks its own iterator, so queries are grouped in
+    // parallel and their results are appended in query order afterwards
+    auto nq = static_cast<int64_t>(iterators.size());
+    std::vector<GroupByQueryResult> results(nq);
+    auto parallelism =
+        segcore::SegcoreConfig::default_config().get_group_by_parallelism();
+    VisitDataGetter<T>(
+        segment,
+        search_info.group_by_field_id_.value(),
+        [&](const auto& data_getter) {
+            futures::ParallelForEach(nq, parallelism, [&](int64_t i) {
+                auto& result = results[i];
+                GroupIteratorResult(iterators[i],
+                                    search_info.topk_,
+                                    search_info.group_size_,
+                                    search_info.group_strict_size_,
+                                    data_getter,
+                                    result.group_by_values,
+                                    result.offsets,
+                                    result.distances,
+                                    search_info.metric_type_);
+            });
+        });
+
     topk_per_nq_prefix_sum.push_back(0);
-    for (auto& iterator : iterators) {
-        GroupIteratorResult<T>(iterator,
-                               topK,
-                               group_size,
-                               group_strict_size,
-                               data_getter,
-                               group_by_values,
-                               seg_offsets,
-                               distances,
-                               metrics_type);
+    for (auto& result : results) {
+        seg_offsets.insert(
+            seg_offsets.end(), result.offsets.begin(), result.offsets.end());
+        distances.insert(
+            distances.end(), result.distances.begin(), result.distances.end());
+        std::move(result.group_by_values.begin(),
+                  result.group_by_values.end(),
+                  std::back_inserter(group_by_values));
         topk_per_nq_prefix_sum.push_back(seg_offsets.size());
     }
 }
 
-template <typename T>
+template <typename Getter>
 void
 GroupIteratorResult(const std::shared_ptr<VectorIterator>& iterator,
                     int64_t topK,
                     int64_t group_size,
                     bool group_strict_size,
-                    const DataGetter<T>& data_getter,
+                    const Getter& data_getter,
                     std::vector<GroupByValueType>& group_by_values,
                     std::vector<int64_t>& offsets,
                     std::vector<float>& distances,
                     const knowhere::MetricType& metrics_type) {
+    using Key = typename Getter::Key;
     //1.
-    GroupByMap<T> groupMap(topK, group_size, group_strict_size);
+    GroupByMap<Key> groupMap(topK, group_size, group_strict_size);
 
     //2. do iteration until fill the whole map or run out of all data
     //note it may enumerate all data inside a segment and can block following
     //query and search possibly
-    std::vector<std::tuple<int64_t, float, T>> res;
+    //rows are pulled in batches no larger than the rows the map still needs
+    //at least, so no more rows are taken from the iterator than one by one
+    std::array<int64_t, GROUP_BY_BATCH_SIZE> batch_offsets;
+    std::array<float, GROUP_BY_BATCH_SIZE> batch_distances;
+    std::array<Key, GROUP_BY_BATCH_SIZE> batch_keys;
+    std::vector<std::tuple<int64_t, float, Key>> res;
     while (iterator->HasNext() && !groupMap.IsGroupResEnough()) {
-        auto offset_dis_pair = iterator->Next();
-        AssertInfo(
-            offset_dis_pair.has_value(),
-            "Wrong state! iterator cannot return valid result whereas it still"
-            "tells hasNext, terminate groupBy operation");
-        auto offset = offset_dis_pair.value().first;
-        auto dis = offset_dis_pair.value().second;
-        T row_data = data_getter.Get(offset);
-        if (groupMap.Push(row_data)) {
-            res.emplace_back(offset, dis, row_data);
+        auto batch_limit =
+            std::min(GROUP_BY_BATCH_SIZE, groupMap.MinRowsToEnough());
+        int64_t batch_size = 0;
+        while (batch_size < batch_limit && iterator->HasNext()) {
+            auto offset_dis_pair = iterator->Next();
+            AssertInfo(offset_dis_pair.has_value(),
+                       "Wrong state! iterator cannot return valid result "
+                       "whereas it still"
+                       "tells hasNext, terminate groupBy operation");
+            batch_offsets[batch_size] = offset_dis_pair.value().first;
+            batch_distances[batch_size] = offset_dis_pair.value().second;
+            batch_size++;
+        }
+        for (int64_t i = 0; i < batch_size; i++) {
+            batch_keys[i] = data_getter.GetKey(batch_offsets[i]);
+        }
+        for (int64_t i = 0; i < batch_size; i++) {
+            if (groupMap.Push(batch_keys[i])) {
+                res.emplace_back(
+                    batch_offsets[i], batch_distances[i], batch_keys[i]);
+            }
         }
     }
 
@@ -203,10 +226,13 @@ GroupIteratorResult(const std::shared_ptr<VectorIterator>& iterator,
     std::sort(res.begin(), res.end(), customComparator);
 
     //4. save groupBy results
+    offsets.reserve(res.size());
+    distances.reserve(res.size());
+    group_by_values.reserve(res.size());
     for (auto iter = res.cbegin(); iter != res.cend(); iter++) {
         offsets.emplace_back(std::get<0>(*iter));
         distances.emplace_back(std::get<1>(*iter));
-        group_by_values.emplace_back(std::move(std::get<2>(*iter)));
+        group_by_values.emplace_back(data_getter.GetValue(std::get<2>(*iter)));
     }
 }
 
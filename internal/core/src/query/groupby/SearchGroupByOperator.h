@@ -16,7 +16,12 @@
 
 #pragma once
 
+#include <array>
+#include <string_view>
+#include <type_traits>
+
 #include "common/QueryInfo.h"
+#include "index/StringIndexMarisa.h"
 #include "knowhere/index/index_node.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/SegmentGrowingImpl.h"
@@ -28,95 +33,152 @@
 namespace milvus {
 namespace query {
 
+// Group-by values are read through getters that are resolved once per
+// search instead of per row. A getter hands out a cheap `Key` for the value
+// of a row (the value itself for numbers, a view into the column or a trie
+// key id for strings), and only the keys of the rows that are kept are
+// turned back into values.
 template <typename T>
-class DataGetter {
- public:
-    virtual T
-    Get(int64_t idx) const = 0;
-};
+using DefaultGroupKey =
+    std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
 
 template <typename T>
-class GrowingDataGetter : public DataGetter<T> {
+class GrowingDataGetter {
  public:
-    const segcore::ConcurrentVector<T>* growing_raw_data_;
+    using Key = DefaultGroupKey<T>;
+
     GrowingDataGetter(const segcore::SegmentGrowingImpl& segment,
-                      FieldId fieldId) {
-        growing_raw_data_ = segment.get_insert_record().get_data<T>(fieldId);
+                      FieldId field_id) {
+        growing_raw_data_ = segment.get_insert_record().get_data<T>(field_id);
     }
 
-    GrowingDataGetter(const GrowingDataGetter<T>& other)
-        : growing_raw_data_(other.growing_raw_data_) {
+    // strings stay in place as growing chunks are never reallocated
+    Key
+    GetKey(int64_t idx) const {
+        return growing_raw_data_->operator[](idx);
     }
 
     T
-    Get(int64_t idx) const {
-        return growing_raw_data_->operator[](idx);
+    GetValue(const Key& key) const {
+        return T(key);
     }
-};
 
-template <typename T>
-class SealedDataGetter : public DataGetter<T> {
  private:
-    std::shared_ptr<Span<T>> field_data_;
-    std::shared_ptr<std::vector<std::string_view>> str_field_data_;
-    const index::ScalarIndex<T>* field_index_;
+    const segcore::ConcurrentVector<T>* growing_raw_data_;
+};
 
+template <typename T>
+class SealedDataGetter {
  public:
+    using Key = DefaultGroupKey<T>;
+
     SealedDataGetter(const segcore::SegmentSealedImpl& segment,
-                     FieldId& field_id) {
-        if (segment.HasFieldData(field_id)) {
-            if constexpr (std::is_same_v<T, std::string>) {
-                str_field_data_ =
-                    std::make_shared<std::vector<std::string_view>>(
-                        segment.chunk_view<std::string_view>(field_id, 0)
-                            .first);
-            } else {
-                auto span = segment.chunk_data<T>(field_id, 0);
-                field_data_ = std::make_shared<Span<T>>(
-                    span.data(), span.valid_data(), span.row_count());
-            }
-        } else if (segment.HasIndex(field_id)) {
-            this->field_index_ = &(segment.chunk_scalar_index<T>(field_id, 0));
+                     FieldId field_id) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            str_field_data_ =
+                segment.chunk_view<std::string_view>(field_id, 0).first;
         } else {
-            PanicInfo(UnexpectedError,
-                      "The segment used to init data getter has no effective "
-                      "data source, neither"
-                      "index or data");
+            field_data_ = segment.chunk_data<T>(field_id, 0).data();
         }
     }
 
-    SealedDataGetter(const SealedDataGetter<T>& other)
-        : field_data_(other.field_data_),
-          str_field_data_(other.str_field_data_),
-          field_index_(other.field_index_) {
+    Key
+    GetKey(int64_t idx) const {
+        if constexpr (std::is_same_v<T, std::string>) {
+            return str_field_data_[idx];
+        } else {
+            return field_data_[idx];
+        }
     }
 
     T
-    Get(int64_t idx) const {
-        if (field_data_ || str_field_data_) {
-            if constexpr (std::is_same_v<T, std::string>) {
-                std::string_view str_val_view =
-                    str_field_data_->operator[](idx);
-                return std::string(str_val_view.data(), str_val_view.length());
-            }
-            return field_data_->operator[](idx);
-        } else {
-            return (*field_index_).Reverse_Lookup(idx);
-        }
+    GetValue(const Key& key) const {
+        return T(key);
     }
+
+ private:
+    const T* field_data_{nullptr};
+    std::vector<std::string_view> str_field_data_;
 };
 
 template <typename T>
-static const std::shared_ptr<DataGetter<T>>
-GetDataGetter(const segcore::SegmentInternalInterface& segment,
-              FieldId fieldId) {
-    if (const segcore::SegmentGrowingImpl* growing_segment =
+class SealedIndexDataGetter {
+ public:
+    using Key = T;
+
+    SealedIndexDataGetter(const segcore::SegmentSealedImpl& segment,
+                          FieldId field_id)
+        : field_index_(&(segment.chunk_scalar_index<T>(field_id, 0))) {
+    }
+
+    Key
+    GetKey(int64_t idx) const {
+        return field_index_->Reverse_Lookup(idx);
+    }
+
+    T
+    GetValue(const Key& key) const {
+        return key;
+    }
+
+ private:
+    const index::ScalarIndex<T>* field_index_;
+};
+
+// the trie key ids of a marisa index already form a dense dictionary of the
+// distinct values, so strings are only rebuilt for the kept rows
+class StringIndexMarisaDataGetter {
+ public:
+    using Key = size_t;
+
+    explicit StringIndexMarisaDataGetter(const index::StringIndexMarisa& index)
+        : field_index_(&index) {
+    }
+
+    Key
+    GetKey(int64_t idx) const {
+        return field_index_->KeyId(idx);
+    }
+
+    std::string
+    GetValue(const Key& key) const {
+        return field_index_->KeyById(key);
+    }
+
+ private:
+    const index::StringIndexMarisa* field_index_;
+};
+
+// Calls `func` with the getter that fits how the field is held in `segment`.
+template <typename T, typename Func>
+void
+VisitDataGetter(const segcore::SegmentInternalInterface& segment,
+                FieldId field_id,
+                Func&& func) {
+    if (auto growing_segment =
             dynamic_cast<const segcore::SegmentGrowingImpl*>(&segment)) {
-        return std::make_shared<GrowingDataGetter<T>>(*growing_segment,
-                                                      fieldId);
-    } else if (const segcore::SegmentSealedImpl* sealed_segment =
+        func(GrowingDataGetter<T>(*growing_segment, field_id));
+    } else if (auto sealed_segment =
                    dynamic_cast<const segcore::SegmentSealedImpl*>(&segment)) {
-        return std::make_shared<SealedDataGetter<T>>(*sealed_segment, fieldId);
+        if (sealed_segment->HasFieldData(field_id)) {
+            func(SealedDataGetter<T>(*sealed_segment, field_id));
+        } else if (sealed_segment->HasIndex(field_id)) {
+            if constexpr (std::is_same_v<T, std::string>) {
+                auto marisa_index =
+                    dynamic_cast<const index::StringIndexMarisa*>(
+                        &(sealed_segment->chunk_scalar_index<T>(field_id, 0)));
+                if (marisa_index != nullptr) {
+                    func(StringIndexMarisaDataGetter(*marisa_index));
+                    return;
+                }
+            }
+            func(SealedIndexDataGetter<T>(*sealed_segment, field_id));
+        } else {
+            PanicInfo(UnexpectedError,
+                      "The segment used to init data getter has no effective "
+                      "data source, neither"
+                      "index or data");
+        }
     } else {
         PanicInfo(UnexpectedError,
                   "The segment used to init data getter is neither growing or "
@@ -180,70 +242,120 @@ template <typename T>
 void
 GroupIteratorsByType(
     const std::vector<std::shared_ptr<VectorIterator>>& iterators,
-    int64_t topK,
-    int64_t group_size,
-    bool group_strict_size,
-    const DataGetter<T>& data_getter,
+    const SearchInfo& search_info,
+    const segcore::SegmentInternalInterface& segment,
     std::vector<GroupByValueType>& group_by_values,
     std::vector<int64_t>& seg_offsets,
     std::vector<float>& distances,
-    const knowhere::MetricType& metrics_type,
     std::vector<size_t>& topk_per_nq_prefix_sum);
 
-template <typename T>
+// Counts rows per group for one query. Groups get dense ids in the order
+// they are first seen and their counts live in a flat array; keys of a
+// single byte skip hashing altogether.
+template <typename Key>
 struct GroupByMap {
  private:
-    std::unordered_map<T, int> group_map_{};
+    static constexpr bool kFlatKey = sizeof(Key) == 1;
+    static constexpr int32_t kNoGroup = -1;
+
+    std::unordered_map<Key, int32_t> group_ids_{};
+    std::array<int32_t, 256> flat_group_ids_{};
+    std::vector<int32_t> group_counts_{};
     int group_capacity_{0};
     int group_size_{0};
     int enough_group_count_{0};
+    int64_t pushed_count_{0};
     bool strict_group_size_{false};
 
+    int32_t
+    GetOrAddGroup(const Key& key) {
+        int32_t* id_slot;
+        if constexpr (kFlatKey) {
+            id_slot = &flat_group_ids_[static_cast<uint8_t>(key)];
+        } else {
+            auto it = group_ids_.find(key);
+            id_slot = it == group_ids_.end() ? nullptr : &it->second;
+        }
+        if (id_slot != nullptr && *id_slot != kNoGroup) {
+            return *id_slot;
+        }
+        if (int64_t(group_counts_.size()) >= group_capacity_) {
+            return kNoGroup;
+        }
+        auto id = static_cast<int32_t>(group_counts_.size());
+        group_counts_.push_back(0);
+        if constexpr (kFlatKey) {
+            *id_slot = id;
+        } else {
+            group_ids_.emplace(key, id);
+        }
+        return id;
+    }
+
  public:
     GroupByMap(int group_capacity,
                int group_size,
                bool strict_group_size = false)
         : group_capacity_(group_capacity),
           group_size_(group_size),
-          strict_group_size_(strict_group_size){};
+          strict_group_size_(strict_group_size) {
+        flat_group_ids_.fill(kNoGroup);
+        group_counts_.reserve(group_capacity);
+    }
+
     bool
-    IsGroupResEnough() {
+    IsGroupResEnough() const {
         bool enough = false;
         if (strict_group_size_) {
-            enough = group_map_.size() == group_capacity_ &&
+            enough = int64_t(group_counts_.size()) == group_capacity_ &&
                      enough_group_count_ == group_capacity_;
         } else {
-            enough = group_map_.size() == group_capacity_;
+            enough = int64_t(group_counts_.size()) == group_capacity_;
         }
         return enough;
     }
+
+    // a lower bound of the rows still to push before the result is enough,
+    // rows of a batch this size can all be pushed without overshooting
+    int64_t
+    MinRowsToEnough() const {
+        int64_t rows = 0;
+        if (strict_group_size_) {
+            rows = int64_t(group_capacity_) * group_size_ - pushed_count_;
+        } else {
+            rows = group_capacity_ - int64_t(group_counts_.size());
+        }
+        return std::max<int64_t>(rows, 1);
+    }
+
     bool
-    Push(const T& t) {
-        if (group_map_.size() >= group_capacity_ &&
-            group_map_.find(t) == group_map_.end()) {
+    Push(const Key& key) {
+        auto id = GetOrAddGroup(key);
+        if (id == kNoGroup) {
             return false;
         }
-        if (group_map_[t] >= group_size_) {
+        if (group_counts_[id] >= group_size_) {
             //we ignore following input no matter the distance as knowhere::iterator doesn't guarantee
             //strictly increase/decreasing distance output
             //but this should not be a very serious influence to overall recall rate
             return false;
         }
-        group_map_[t] += 1;
-        if (group_map_[t] >= group_size_) {
+        group_counts_[id] += 1;
+        pushed_count_++;
+        if (group_counts_[id] >= group_size_) {
             enough_group_count_ += 1;
         }
         return true;
     }
 };
 
-template <typename T>
+template <typename Getter>
 void
 GroupIteratorResult(const std::shared_ptr<VectorIterator>& iterator,
                     int64_t topK,
                     int64_t group_size,
                     bool group_strict_size,
-                    const DataGetter<T>& data_getter,
+                    const Getter& data_getter,
                     std::vector<GroupByValueType>& group_by_values,
                     std::vector<int64_t>& offsets,
                     std::vector<float>& distances,
@@ -11,10 +11,15 @@
 
 #include "query/generated/ExecPlanNodeVisitor.h"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "expr/ITypeExpr.h"
+#include "query/CountPushdown.h"
 #include "query/PlanImpl.h"
 #include "query/SubSearchResult.h"
 #include "query/generated/ExecExprVisitor.h"
@@ -24,6 +29,8 @@
 #include "log/Log.h"
 #include "plan/PlanNode.h"
 #include "exec/Task.h"
+#include "exec/expression/Expr.h"
+#include "futures/Executor.h"
 #include "segcore/SegmentInterface.h"
 #include "query/groupby/SearchGroupByOperator.h"
 namespace milvus::query {
@@ -74,6 +81,310 @@ empty_search_result(int64_t num_queries, SearchInfo& search_info) {
     return final_result;
 }
 
+static bool
+CanExecuteInMorsels(const std::shared_ptr<milvus::plan::PlanNode>& plannode,
+                    milvus::exec::QueryContext* query_context) {
+    auto segment = query_context->get_segment();
+    auto& query_config = *query_context->query_config();
+    // the morsels write to the same bitset, they must not share its words
+    constexpr int64_t kWordBits = sizeof(BitsetType::data_type) * 8;
+    if (segment->type() != SegmentType::Sealed ||
+        query_config.get_expr_max_drivers() <= 1 ||
+        query_context->get_active_count() <=
+            query_config.get_expr_morsel_size() ||
+        query_config.get_expr_morsel_size() % kWordBits != 0) {
+        return false;
+    }
+    auto filter_node =
+        std::dynamic_pointer_cast<const milvus::plan::FilterBitsNode>(plannode);
+    if (!filter_node) {
+        return false;
+    }
+    return milvus::exec::SupportMorselExecution(filter_node->filter(),
+                                                *segment);
+}
+
+// Copies the result of the batch starting at row `offset` into `output`,
+// unless the exprs already wrote it there.
+static void
+WriteBatchResult(BitsetType& output, int64_t offset, ColumnVector& vec) {
+    constexpr int64_t kWordBits = sizeof(BitsetType::data_type) * 8;
+    AssertInfo(offset + vec.size() <= output.size(),
+               "expr result of rows [{}, {}) exceeds active count {}",
+               offset,
+               offset + vec.size(),
+               output.size());
+    auto data = static_cast<const BitsetType::data_type*>(vec.GetRawData());
+    if (offset % kWordBits == 0 && data == output.data() + offset / kWordBits) {
+        return;
+    }
+    BitsetType::policy_type::op_copy(
+        data, 0, output.data(), offset, vec.size());
+}
+
+// Splits the segment into morsels of whole expr batches and evaluates each of
+// them with its own task on futures::ParallelForEach. The morsels write their
+// results to the output bitset of query_context.
+static void
+ExecuteExprNodeInMorsels(const milvus::plan::PlanFragment& plan,
+                         milvus::exec::QueryContext* query_context) {
+    auto segment = query_context->get_segment();
+    auto active_count = query_context->get_active_count();
+    auto timestamp = query_context->get_query_timestamp();
+    auto query_config = query_context->query_config();
+    auto output = query_context->get_output();
+    auto morsel_size = query_config->get_expr_morsel_size();
+    auto num_morsels = upper_div(active_count, morsel_size);
+
+    milvus::futures::ParallelForEach(
+        num_morsels,
+        query_config->get_expr_max_drivers(),
+        [&](int64_t morsel) {
+            auto row_offset = morsel * morsel_size;
+            auto morsel_context = std::make_shared<milvus::exec::QueryContext>(
+                DEAFULT_QUERY_ID,
+                segment,
+                std::min(active_count, row_offset + morsel_size),
+                timestamp,
+                query_config);
+            morsel_context->set_row_offset(row_offset);
+            morsel_context->set_output(output);
+            auto task = milvus::exec::Task::Create(
+                DEFAULT_TASK_ID, plan, 0, morsel_context);
+            auto offset = row_offset;
+            for (;;) {
+                auto result = task->Next();
+                if (!result) {
+                    break;
+                }
+                auto vec =
+                    std::dynamic_pointer_cast<ColumnVector>(result->child(0));
+                AssertInfo(vec != nullptr,
+                           "morsel expr result should be a column vector");
+                WriteBatchResult(*output, offset, *vec);
+                offset += vec->size();
+            }
+        });
+}
+
+// The cache key is a sequence of length prefixed fields, so that no two
+// different filters encode the same, whatever their names, paths or values
+// contain.
+static void
+AppendKeyField(std::string& key, const std::string& field) {
+    key += std::to_string(field.size());
+    key += ':';
+    key += field;
+}
+
+static void
+AppendKeyField(std::string& key, int64_t field) {
+    AppendKeyField(key, std::to_string(field));
+}
+
+static void
+AppendKeyField(std::string& key, const expr::ColumnInfo& column) {
+    AppendKeyField(key, column.field_id_.get());
+    AppendKeyField(key, static_cast<int64_t>(column.data_type_));
+    AppendKeyField(key, static_cast<int64_t>(column.element_type_));
+    AppendKeyField(key, static_cast<int64_t>(column.nested_path_.size()));
+    for (auto& name : column.nested_path_) {
+        AppendKeyField(key, name);
+    }
+}
+
+static void
+AppendKeyField(std::string& key, const proto::plan::GenericValue& value) {
+    AppendKeyField(key, value.SerializeAsString());
+}
+
+// Appends the sorted, deduplicated `values`, their order doesn't change the
+// result of in lists and json_contains_any/all.
+static void
+AppendKeyField(std::string& key,
+               const std::vector<proto::plan::GenericValue>& values) {
+    std::vector<std::string> fields;
+    fields.reserve(values.size());
+    for (auto& value : values) {
+        fields.push_back(value.SerializeAsString());
+    }
+    std::sort(fields.begin(), fields.end());
+    fields.erase(std::unique(fields.begin(), fields.end()), fields.end());
+    AppendKeyField(key, static_cast<int64_t>(fields.size()));
+    for (auto& field : fields) {
+        AppendKeyField(key, field);
+    }
+}
+
+static bool
+AppendExprResultCacheKey(const expr::TypedExprPtr& expr,
+                         const std::optional<FieldId>& pk_field_id,
+                         std::string& key);
+
+// Appends the keys of the operands of a chain of `op_type` to `keys`, so
+// `a and (b and c)` and `(c and a) and b` get the same key.
+static bool
+CollectExprResultCacheKeys(const expr::TypedExprPtr& expr,
+                           expr::LogicalBinaryExpr::OpType op_type,
+                           const std::optional<FieldId>& pk_field_id,
+                           std::vector<std::string>& keys) {
+    auto binary_expr =
+        std::dynamic_pointer_cast<const expr::LogicalBinaryExpr>(expr);
+    if (binary_expr && binary_expr->op_type_ == op_type) {
+        for (auto& input : binary_expr->inputs()) {
+            if (!CollectExprResultCacheKeys(
+                    input, op_type, pk_field_id, keys)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    std::string key;
+    if (!AppendExprResultCacheKey(expr, pk_field_id, key)) {
+        return false;
+    }
+    keys.push_back(std::move(key));
+    return true;
+}
+
+// Canonical form of a filter, the operands of and/or and the values of in
+// lists are sorted. Every expr starts with its own tag and appends all the
+// members its result depends on. Returns false if the result of the filter
+// can't be cached: pk term filters only match rows visible at the query
+// timestamp, other exprs aren't known here.
+static bool
+AppendExprResultCacheKey(const expr::TypedExprPtr& expr,
+                         const std::optional<FieldId>& pk_field_id,
+                         std::string& key) {
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::LogicalBinaryExpr>(expr)) {
+        std::vector<std::string> keys;
+        if (!CollectExprResultCacheKeys(
+                expr, casted_expr->op_type_, pk_field_id, keys)) {
+            return false;
+        }
+        std::sort(keys.begin(), keys.end());
+        AppendKeyField(key, "LogicalBinary");
+        AppendKeyField(key, static_cast<int64_t>(casted_expr->op_type_));
+        AppendKeyField(key, static_cast<int64_t>(keys.size()));
+        for (auto& input_key : keys) {
+            AppendKeyField(key, input_key);
+        }
+        return true;
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::LogicalUnaryExpr>(expr)) {
+        std::string input_key;
+        if (!AppendExprResultCacheKey(
+                casted_expr->inputs()[0], pk_field_id, input_key)) {
+            return false;
+        }
+        AppendKeyField(key, "LogicalUnary");
+        AppendKeyField(key, static_cast<int64_t>(casted_expr->op_type_));
+        AppendKeyField(key, input_key);
+        return true;
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::TermFilterExpr>(expr)) {
+        if (casted_expr->column_.field_id_ == pk_field_id) {
+            return false;
+        }
+        AppendKeyField(key, "Term");
+        AppendKeyField(key, casted_expr->column_);
+        AppendKeyField(key, static_cast<int64_t>(casted_expr->is_in_field_));
+        AppendKeyField(key, casted_expr->vals_);
+        return true;
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::UnaryRangeFilterExpr>(
+                expr)) {
+        AppendKeyField(key, "UnaryRange");
+        AppendKeyField(key, casted_expr->column_);
+        AppendKeyField(key, static_cast<int64_t>(casted_expr->op_type_));
+        AppendKeyField(key, casted_expr->val_);
+        return true;
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::BinaryRangeFilterExpr>(
+                expr)) {
+        AppendKeyField(key, "BinaryRange");
+        AppendKeyField(key, casted_expr->column_);
+        AppendKeyField(key, casted_expr->lower_val_);
+        AppendKeyField(key, casted_expr->upper_val_);
+        AppendKeyField(key,
+                       static_cast<int64_t>(casted_expr->lower_inclusive_));
+        AppendKeyField(key,
+                       static_cast<int64_t>(casted_expr->upper_inclusive_));
+        return true;
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::BinaryArithOpEvalRangeExpr>(
+                expr)) {
+        AppendKeyField(key, "BinaryArithOpEvalRange");
+        AppendKeyField(key, casted_expr->column_);
+        AppendKeyField(key, static_cast<int64_t>(casted_expr->op_type_));
+        AppendKeyField(key, static_cast<int64_t>(casted_expr->arith_op_type_));
+        AppendKeyField(key, casted_expr->right_operand_);
+        AppendKeyField(key, casted_expr->value_);
+        return true;
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::CompareExpr>(expr)) {
+        AppendKeyField(key, "Compare");
+        AppendKeyField(key, casted_expr->left_field_id_.get());
+        AppendKeyField(key,
+                       static_cast<int64_t>(casted_expr->left_data_type_));
+        AppendKeyField(key, casted_expr->right_field_id_.get());
+        AppendKeyField(key,
+                       static_cast<int64_t>(casted_expr->right_data_type_));
+        AppendKeyField(key, static_cast<int64_t>(casted_expr->op_type_));
+        return true;
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::ExistsExpr>(expr)) {
+        AppendKeyField(key, "Exists");
+        AppendKeyField(key, casted_expr->column_);
+        return true;
+    }
+    if (auto casted_expr =
+            std::dynamic_pointer_cast<const expr::JsonContainsExpr>(expr)) {
+        AppendKeyField(key, "JsonContains");
+        AppendKeyField(key, casted_expr->column_);
+        AppendKeyField(key, static_cast<int64_t>(casted_expr->op_));
+        AppendKeyField(key, static_cast<int64_t>(casted_expr->same_type_));
+        AppendKeyField(key, casted_expr->vals_);
+        return true;
+    }
+    if (std::dynamic_pointer_cast<const expr::AlwaysTrueExpr>(expr)) {
+        AppendKeyField(key, "AlwaysTrue");
+        return true;
+    }
+    return false;
+}
+
+// Key of the filter of `plannode` in the expr result cache of `segment`,
+// std::nullopt if the result shouldn't be cached.
+static std::optional<std::string>
+ExprResultCacheKey(const std::shared_ptr<milvus::plan::PlanNode>& plannode,
+                   const milvus::segcore::SegmentInternalInterface* segment) {
+    if (segment->get_expr_result_cache() == nullptr ||
+        !milvus::segcore::ExprResultCache::enabled()) {
+        return std::nullopt;
+    }
+    auto filter_node =
+        std::dynamic_pointer_cast<const milvus::plan::FilterBitsNode>(plannode);
+    if (!filter_node) {
+        return std::nullopt;
+    }
+    std::string key;
+    if (!AppendExprResultCacheKey(filter_node->filter(),
+                                  segment->get_schema().get_primary_field_id(),
+                                  key)) {
+        return std::nullopt;
+    }
+    return key;
+}
+
 void
 ExecPlanNodeVisitor::ExecuteExprNode(
     const std::shared_ptr<milvus::plan::PlanNode>& plannode,
@@ -85,14 +396,42 @@ ExecPlanNodeVisitor::ExecuteExprNode(
               plannode->ToString(),
               active_count,
               timestamp_);
+    // the cached results don't depend on the query, deletes and timestamps
+    // are applied by the callers
+    auto cache_key = ExprResultCacheKey(plannode, segment);
+    auto cache_result = [&]() {
+        if (cache_key.has_value()) {
+            segment->get_expr_result_cache()->Put(
+                cache_key.value(),
+                std::make_shared<const BitsetType>(bitset_holder.clone()));
+        }
+    };
+    if (cache_key.has_value()) {
+        if (auto cached = segment->get_expr_result_cache()->Get(
+                cache_key.value(), active_count)) {
+            bitset_holder.append(*cached, 0, active_count);
+            return;
+        }
+    }
+
     auto plan = plan::PlanFragment(plannode);
     // TODO: get query id from proxy
     auto query_context = std::make_shared<milvus::exec::QueryContext>(
         DEAFULT_QUERY_ID, segment, active_count, timestamp_);
+    // the exprs write the batches straight into bitset_holder where they can
+    bitset_holder.resize(active_count, false);
+    query_context->set_output(&bitset_holder);
+
+    if (CanExecuteInMorsels(plannode, query_context.get())) {
+        ExecuteExprNodeInMorsels(plan, query_context.get());
+        cache_result();
+        return;
+    }
 
     auto task =
         milvus::exec::Task::Create(DEFAULT_TASK_ID, plan, 0, query_context);
     bool cache_offset_getted = false;
+    int64_t offset = 0;
     for (;;) {
         auto result = task->Next();
         if (!result) {
@@ -103,14 +442,14 @@ ExecPlanNodeVisitor::ExecuteExprNode(
                    "expr result vector's children size not equal one");
         LOG_DEBUG("output result length:{}", childrens[0]->size());
         if (auto vec = std::dynamic_pointer_cast<ColumnVector>(childrens[0])) {
-            TargetBitmapView view(vec->GetRawData(), vec->size());
-            AppendOneChunk(bitset_holder, view);
+            WriteBatchResult(bitset_holder, offset, *vec);
+            offset += vec->size();
         } else if (auto row =
                        std::dynamic_pointer_cast<RowVector>(childrens[0])) {
             auto bit_vec =
                 std::dynamic_pointer_cast<ColumnVector>(row->child(0));
-            TargetBitmapView view(bit_vec->GetRawData(), bit_vec->size());
-            AppendOneChunk(bitset_holder, view);
+            WriteBatchResult(bitset_holder, offset, *bit_vec);
+            offset += bit_vec->size();
 
             if (!cache_offset_getted) {
                 // offset cache only get once because not support iterator batch
@@ -119,9 +458,8 @@ ExecPlanNodeVisitor::ExecuteExprNode(
                 TargetBitmapView view(cache_bits_vec->GetRawData(),
                                       cache_bits_vec->size());
                 // If get empty cached bits. mean no record hits in this segment
-                // no need to get next batch.
+                // no need to get next batch, the other rows are left unset.
                 if (view.count() == 0) {
-                    bitset_holder.resize(active_count);
                     task->RequestCancel();
                     break;
                 }
@@ -131,6 +469,7 @@ ExecPlanNodeVisitor::ExecuteExprNode(
             PanicInfo(UnexpectedError, "expr return type not matched");
         }
     }
+    cache_result();
     //    std::string s;
     //    boost::to_string(*bitset_holder, s);
     //    std::cout << bitset_holder->size() << " .  " << s << std::endl;
@@ -172,9 +511,11 @@ ExecPlanNodeVisitor::VectorVisitorImpl(VectorPlanNode& node) {
     } else {
         bitset_holder = std::make_unique<BitsetType>(active_count, false);
     }
-    segment->mask_with_timestamps(*bitset_holder, timestamp_);
-
+    // the delete bitmap covers the active count only, while sealed segments
+    // mask the rows past it along with the timestamps
     segment->mask_with_delete(*bitset_holder, active_count, timestamp_);
+
+    segment->mask_with_timestamps(*bitset_holder, timestamp_);
     std::chrono::high_resolution_clock::time_point scalar_end =
         std::chrono::high_resolution_clock::now();
     double scalar_cost =
@@ -259,18 +600,46 @@ ExecPlanNodeVisitor::visit(RetrievePlanNode& node) {
     retrieve_result.total_data_cnt_ = 0;
 
     auto active_count = segment->get_active_count(timestamp_);
+    // the size the bitset below would have, mask_with_timestamps extends it
+    // to every row of a sealed segment
+    auto total_data_cnt = segment->type() == SegmentType::Sealed
+                              ? segment->get_row_count()
+                              : active_count;
 
     if (active_count == 0 && !node.is_count_) {
+        retrieve_result.total_data_cnt_ = total_data_cnt;
         retrieve_result_opt_ = std::move(retrieve_result);
         return;
     }
 
     if (active_count == 0 && node.is_count_) {
         retrieve_result = *(wrap_num_entities(0));
+        retrieve_result.total_data_cnt_ = total_data_cnt;
         retrieve_result_opt_ = std::move(retrieve_result);
         return;
     }
 
+    if (node.is_count_) {
+        // answer simple counts from index postings and chunk statistics
+        // before paying for a full bitset.
+        std::optional<int64_t> cnt;
+        if (!node.filter_plannode_.has_value()) {
+            cnt = TryCountWithoutBitset(
+                *segment, nullptr, active_count, timestamp_);
+        } else if (auto filter_node =
+                       std::dynamic_pointer_cast<plan::FilterBitsNode>(
+                           node.filter_plannode_.value())) {
+            cnt = TryCountWithoutBitset(
+                *segment, filter_node->filter(), active_count, timestamp_);
+        }
+        if (cnt.has_value()) {
+            retrieve_result = *(wrap_num_entities(cnt.value()));
+            retrieve_result.total_data_cnt_ = total_data_cnt;
+            retrieve_result_opt_ = std::move(retrieve_result);
+            return;
+        }
+    }
+
     BitsetType bitset_holder;
     // For case that retrieve by expression, bitset will be allocated when expression is being executed.
     if (node.is_count_) {
@@ -286,9 +655,9 @@ ExecPlanNodeVisitor::visit(RetrievePlanNode& node) {
         bitset_holder.flip();
     }
 
-    segment->mask_with_timestamps(bitset_holder, timestamp_);
-
     segment->mask_with_delete(bitset_holder, active_count, timestamp_);
+
+    segment->mask_with_timestamps(bitset_holder, timestamp_);
     // if bitset_holder is all 1's, we got empty result
     if (bitset_holder.all() && !node.is_count_) {
         retrieve_result_opt_ = std::move(retrieve_result);
@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -21,6 +25,7 @@
 #include "AckResponder.h"
 #include "common/Schema.h"
 #include "common/Types.h"
+#include "monitor/prometheus_client.h"
 #include "segcore/Record.h"
 #include "ConcurrentVector.h"
 
@@ -31,54 +36,93 @@ struct DeletedRecord {
         // Just for query
         int64_t del_barrier = 0;
         BitsetTypePtr bitmap_ptr;
+        // the use clock of the last query served by this bitmap, bumped
+        // under the shared lock so cache hits don't exclude each other
+        std::atomic<uint64_t> last_used = 0;
 
         std::shared_ptr<TmpBitmap>
         clone(int64_t capacity);
     };
     static constexpr int64_t deprecated_size_per_chunk = 32 * 1024;
+    // max number of deleted bitmaps kept, one per (insert_barrier,
+    // del_barrier) pair, so queries at different timestamps don't keep
+    // evicting each other's bitmap.
+    static constexpr size_t bitmap_cache_capacity = 4;
+
     DeletedRecord()
-        : lru_(std::make_shared<TmpBitmap>()),
-          timestamps_(deprecated_size_per_chunk),
+        : timestamps_(deprecated_size_per_chunk),
           pks_(deprecated_size_per_chunk) {
-        lru_->bitmap_ptr = std::make_shared<BitsetType>();
+        auto empty = std::make_shared<TmpBitmap>();
+        empty->bitmap_ptr = std::make_shared<BitsetType>();
+        bitmap_cache_.push_back(std::move(empty));
     }
 
     auto
     get_lru_entry() {
         std::shared_lock lck(shared_mutex_);
-        return lru_;
+        return *std::max_element(
+            bitmap_cache_.begin(),
+            bitmap_cache_.end(),
+            [](const auto& lhs, const auto& rhs) {
+                return lhs->last_used.load() < rhs->last_used.load();
+            });
     }
 
+    // On a hit the cached entry itself is returned and must not be modified.
+    // Otherwise returns a copy of the closest cached bitmap resized to
+    // insert_barrier, deletes between old_del_barrier and del_barrier still
+    // need to be applied to it.
     std::shared_ptr<TmpBitmap>
     clone_lru_entry(int64_t insert_barrier,
                     int64_t del_barrier,
                     int64_t& old_del_barrier,
                     bool& hit_cache) {
-        std::shared_lock lck(shared_mutex_);
-        auto res = lru_->clone(insert_barrier);
-        old_del_barrier = lru_->del_barrier;
-
-        if (lru_->bitmap_ptr->size() == insert_barrier &&
-            lru_->del_barrier == del_barrier) {
-            hit_cache = true;
-        } else {
-            res->del_barrier = del_barrier;
+        std::shared_ptr<TmpBitmap> base;
+        {
+            std::shared_lock lck(shared_mutex_);
+            for (auto& entry : bitmap_cache_) {
+                if (entry->bitmap_ptr->size() == insert_barrier &&
+                    entry->del_barrier == del_barrier) {
+                    entry->last_used = ++use_clock_;
+                    hit_cache = true;
+                    old_del_barrier = del_barrier;
+                    monitor::internal_deleted_bitmap_cache_op_count_hit
+                        .Increment();
+                    return entry;
+                }
+            }
+            base = closest_entry(insert_barrier, del_barrier);
         }
+        monitor::internal_deleted_bitmap_cache_op_count_miss.Increment();
 
+        // entries are never modified once cached, copy out of the lock
+        old_del_barrier = base->del_barrier;
+        auto res = base->clone(insert_barrier);
+        res->del_barrier = del_barrier;
         return res;
     }
 
     void
-    insert_lru_entry(std::shared_ptr<TmpBitmap> new_entry, bool force = false) {
+    insert_lru_entry(std::shared_ptr<TmpBitmap> new_entry) {
         std::lock_guard lck(shared_mutex_);
-        if (new_entry->del_barrier <= lru_->del_barrier) {
-            if (!force ||
-                new_entry->bitmap_ptr->size() <= lru_->bitmap_ptr->size()) {
-                // DO NOTHING
+        for (auto& entry : bitmap_cache_) {
+            if (entry->bitmap_ptr->size() == new_entry->bitmap_ptr->size() &&
+                entry->del_barrier == new_entry->del_barrier) {
+                // computed concurrently by another query
                 return;
             }
         }
-        lru_ = std::move(new_entry);
+        new_entry->last_used = ++use_clock_;
+        bitmap_cache_.push_back(std::move(new_entry));
+        if (bitmap_cache_.size() > bitmap_cache_capacity) {
+            // evict the least recently used one
+            bitmap_cache_.erase(std::min_element(
+                bitmap_cache_.begin(),
+                bitmap_cache_.end(),
+                [](const auto& lhs, const auto& rhs) {
+                    return lhs->last_used.load() < rhs->last_used.load();
+                }));
+        }
     }
 
     void
@@ -130,8 +174,30 @@ struct DeletedRecord {
     }
 
  private:
-    std::shared_ptr<TmpBitmap> lru_;
+    // Prefers a bitmap of the same size that only needs newer deletes
+    // applied, then the one with the nearest del_barrier.
+    std::shared_ptr<TmpBitmap>
+    closest_entry(int64_t insert_barrier, int64_t del_barrier) const {
+        auto rank = [&](const std::shared_ptr<TmpBitmap>& entry) {
+            return std::make_tuple(
+                entry->bitmap_ptr->size() != insert_barrier,
+                entry->del_barrier > del_barrier,
+                std::abs(entry->del_barrier - del_barrier));
+        };
+        auto best = bitmap_cache_.begin();
+        for (auto it = std::next(best); it != bitmap_cache_.end(); ++it) {
+            if (rank(*it) < rank(*best)) {
+                best = it;
+            }
+        }
+        return *best;
+    }
+
+ private:
+    // entries are ordered by their last_used stamps, not by position
+    std::list<std::shared_ptr<TmpBitmap>> bitmap_cache_;
     std::shared_mutex shared_mutex_;
+    std::atomic<uint64_t> use_clock_ = 0;
 
     std::shared_mutex buffer_mutex_;
     std::atomic<int64_t> n_ = 0;
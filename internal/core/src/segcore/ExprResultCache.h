@@ -0,0 +1,157 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "common/Common.h"
+#include "common/Types.h"
+#include "monitor/prometheus_client.h"
+
+namespace milvus::segcore {
+
+// Cache of filter results of one sealed segment, keyed by the canonical form
+// of the filter expr. A result holds one bit per row, set where the row
+// matches, before deletes and timestamps are applied, so it stays valid for
+// any query whose active count is not larger than the cached result.
+// The cache must be cleared whenever a field or an index of the segment is
+// loaded or dropped.
+// The results of all segments of the process are kept in one LRU list
+// bounded by EXPR_RESULT_CACHE_SIZE bytes, 0 disables the caches. Making room
+// evicts the least recently used results of whichever segment, so the budget
+// follows the hot segments.
+class ExprResultCache {
+ public:
+    using ResultPtr = std::shared_ptr<const BitsetType>;
+
+    ExprResultCache() = default;
+    ExprResultCache(const ExprResultCache&) = delete;
+    ExprResultCache&
+    operator=(const ExprResultCache&) = delete;
+
+    ~ExprResultCache() {
+        Clear();
+    }
+
+    static bool
+    enabled() {
+        return EXPR_RESULT_CACHE_SIZE > 0;
+    }
+
+    // Returns the cached result of `key` if it covers at least active_count
+    // rows, nullptr otherwise. Cached results are never modified.
+    ResultPtr
+    Get(const std::string& key, int64_t active_count) {
+        std::lock_guard lck(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end() ||
+            it->second->result->size() < static_cast<size_t>(active_count)) {
+            monitor::internal_expr_result_cache_op_count_miss.Increment();
+            return nullptr;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second);
+        monitor::internal_expr_result_cache_op_count_hit.Increment();
+        return it->second->result;
+    }
+
+    void
+    Put(const std::string& key, ResultPtr result) {
+        auto bytes = EntryBytes(key, *result);
+        auto budget = EXPR_RESULT_CACHE_SIZE;
+        if (bytes > budget) {
+            return;
+        }
+        std::lock_guard lck(mutex_);
+        if (auto it = entries_.find(key); it != entries_.end()) {
+            Erase(it->second);
+        }
+        while (!lru_.empty() && total_bytes_ + bytes > budget) {
+            auto victim = std::prev(lru_.end());
+            victim->owner->Erase(victim);
+            monitor::internal_expr_result_cache_op_count_evict.Increment();
+        }
+        lru_.push_front(Entry{this, key, std::move(result), bytes});
+        entries_.emplace(key, lru_.begin());
+        bytes_ += bytes;
+        total_bytes_ += bytes;
+    }
+
+    void
+    Clear() {
+        std::lock_guard lck(mutex_);
+        while (!entries_.empty()) {
+            Erase(entries_.begin()->second);
+        }
+    }
+
+    size_t
+    size() const {
+        std::lock_guard lck(mutex_);
+        return entries_.size();
+    }
+
+    int64_t
+    bytes() const {
+        std::lock_guard lck(mutex_);
+        return bytes_;
+    }
+
+    // bytes held by the caches of all segments
+    static int64_t
+    total_bytes() {
+        std::lock_guard lck(mutex_);
+        return total_bytes_;
+    }
+
+ private:
+    struct Entry {
+        ExprResultCache* owner;
+        std::string key;
+        ResultPtr result;
+        int64_t bytes;
+    };
+    using EntryIter = std::list<Entry>::iterator;
+
+    // requires mutex_ held, it must be an entry of this cache
+    void
+    Erase(EntryIter it) {
+        bytes_ -= it->bytes;
+        total_bytes_ -= it->bytes;
+        entries_.erase(it->key);
+        lru_.erase(it);
+    }
+
+    static int64_t
+    EntryBytes(const std::string& key, const BitsetType& result) {
+        // the key is held twice, by the entry and by the index
+        return static_cast<int64_t>((result.size() + 7) / 8 +
+                                    2 * key.size() + sizeof(Entry));
+    }
+
+    // results of this segment, indexing into lru_
+    std::unordered_map<std::string, EntryIter> entries_;
+    int64_t bytes_ = 0;
+
+    // guards the LRU list and the indexes of all caches
+    inline static std::mutex mutex_;
+    // results of all segments, most recently used first
+    inline static std::list<Entry> lru_;
+    inline static int64_t total_bytes_ = 0;
+};
+
+}  // namespace milvus::segcore
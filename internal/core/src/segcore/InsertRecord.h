@@ -12,7 +12,9 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -22,6 +24,8 @@
 #include <vector>
 #include <queue>
 
+#include <tbb/concurrent_set.h>
+
 #include "TimestampIndex.h"
 #include "common/EasyAssert.h"
 #include "common/Schema.h"
@@ -67,54 +71,64 @@ class OffsetMap {
 
     virtual void
     clear() = 0;
+
+    // bytes held by the index, 0 if not tracked
+    virtual int64_t
+    mem_size() const {
+        return 0;
+    }
 };
 
+// Pk index of growing segments. Entries are kept ordered by (pk, offset) in
+// a concurrent skip list, so inserts, deletes and upserts never wait on each
+// other, point lookups take O(log n) and find_first walks the pks in order
+// without sorting or merging anything, while inserts go on.
 template <typename T>
-class OffsetOrderedMap : public OffsetMap {
+class OffsetConcurrentMap : public OffsetMap {
  public:
     bool
     contain(const PkType& pk) const override {
-        std::shared_lock<std::shared_mutex> lck(mtx_);
-
-        return map_.find(std::get<T>(pk)) != map_.end();
+        const T& target = std::get<T>(pk);
+        auto it = set_.lower_bound(FirstEntryOf(target));
+        return it != set_.end() && it->first == target;
     }
 
     std::vector<int64_t>
     find(const PkType& pk) const override {
-        std::shared_lock<std::shared_mutex> lck(mtx_);
-
-        auto offset_vector = map_.find(std::get<T>(pk));
-        return offset_vector != map_.end() ? offset_vector->second
-                                           : std::vector<int64_t>();
+        const T& target = std::get<T>(pk);
+        std::vector<int64_t> offset_vector;
+        for (auto it = set_.lower_bound(FirstEntryOf(target));
+             it != set_.end() && it->first == target;
+             ++it) {
+            offset_vector.push_back(it->second);
+        }
+        return offset_vector;
     }
 
     void
     insert(const PkType& pk, int64_t offset) override {
-        std::unique_lock<std::shared_mutex> lck(mtx_);
-
-        map_[std::get<T>(pk)].emplace_back(offset);
+        const T& target = std::get<T>(pk);
+        set_.emplace(target, offset);
+        size_.fetch_add(1);
+        mem_size_.fetch_add(EntryBytes(target));
     }
 
     void
     seal() override {
-        PanicInfo(
-            NotImplemented,
-            "OffsetOrderedMap used for growing segment could not be sealed.");
+        PanicInfo(NotImplemented,
+                  "OffsetConcurrentMap used for growing segment could not be "
+                  "sealed.");
     }
 
     bool
     empty() const override {
-        std::shared_lock<std::shared_mutex> lck(mtx_);
-
-        return map_.empty();
+        return size_.load() == 0;
     }
 
     std::pair<std::vector<OffsetMap::OffsetType>, bool>
     find_first(int64_t limit, const BitsetType& bitset) const override {
-        std::shared_lock<std::shared_mutex> lck(mtx_);
-
         if (limit == Unlimited || limit == NoLimit) {
-            limit = map_.size();
+            limit = size_.load();
         }
 
         // TODO: we can't retrieve pk by offset very conveniently.
@@ -122,13 +136,37 @@ class OffsetOrderedMap : public OffsetMap {
         return find_first_by_index(limit, bitset);
     }
 
+    // not safe to call concurrently with any other method
     void
     clear() override {
-        std::unique_lock<std::shared_mutex> lck(mtx_);
-        map_.clear();
+        set_.clear();
+        size_ = 0;
+        mem_size_ = 0;
+    }
+
+    int64_t
+    mem_size() const override {
+        return mem_size_.load();
     }
 
  private:
+    using Entry = std::pair<T, int64_t>;
+
+    static Entry
+    FirstEntryOf(const T& pk) {
+        return {pk, std::numeric_limits<int64_t>::min()};
+    }
+
+    // a skip list node holds the entry and two next pointers on average
+    static int64_t
+    EntryBytes(const T& pk) {
+        int64_t bytes = sizeof(Entry) + 3 * sizeof(void*);
+        if constexpr (std::is_same_v<T, std::string>) {
+            bytes += pk.size();
+        }
+        return bytes;
+    }
+
     std::pair<std::vector<OffsetMap::OffsetType>, bool>
     find_first_by_index(int64_t limit, const BitsetType& bitset) const {
         int64_t hit_num = 0;  // avoid counting the number everytime.
@@ -137,12 +175,22 @@ class OffsetOrderedMap : public OffsetMap {
         limit = std::min(limit, cnt);
         std::vector<int64_t> seg_offsets;
         seg_offsets.reserve(limit);
-        auto it = map_.begin();
-        for (; hit_num < limit && it != map_.end(); it++) {
+        // offsets of the current pk, the skip list only iterates forward
+        std::vector<int64_t> pk_offsets;
+        auto it = set_.begin();
+        while (hit_num < limit && it != set_.end()) {
+            pk_offsets.clear();
+            auto pk_end = it;
+            for (; pk_end != set_.end() && pk_end->first == it->first;
+                 ++pk_end) {
+                pk_offsets.push_back(pk_end->second);
+            }
             // Offsets in the growing segment are ordered by timestamp,
             // so traverse from back to front to obtain the latest offset.
-            for (int i = it->second.size() - 1; i >= 0; --i) {
-                auto seg_offset = it->second[i];
+            for (auto offset_it = pk_offsets.rbegin();
+                 offset_it != pk_offsets.rend();
+                 ++offset_it) {
+                auto seg_offset = *offset_it;
                 if (seg_offset >= size) {
                     // Frequently concurrent insert/query will cause this case.
                     continue;
@@ -155,14 +203,15 @@ class OffsetOrderedMap : public OffsetMap {
                     break;
                 }
             }
+            it = pk_end;
         }
-        return {seg_offsets, it != map_.end()};
+        return {seg_offsets, it != set_.end()};
     }
 
  private:
-    using OrderedMap = std::map<T, std::vector<int64_t>, std::less<>>;
-    OrderedMap map_;
-    mutable std::shared_mutex mtx_;
+    tbb::concurrent_set<Entry> set_;
+    std::atomic<int64_t> size_{0};
+    std::atomic<int64_t> mem_size_{0};
 };
 
 template <typename T>
@@ -368,7 +417,7 @@ struct InsertRecord {
                                 std::make_unique<OffsetOrderedArray<int64_t>>();
                         } else {
                             pk2offset_ =
-                                std::make_unique<OffsetOrderedMap<int64_t>>();
+                                std::make_unique<OffsetConcurrentMap<int64_t>>();
                         }
                         break;
                     }
@@ -378,7 +427,7 @@ struct InsertRecord {
                                 OffsetOrderedArray<std::string>>();
                         } else {
                             pk2offset_ = std::make_unique<
-                                OffsetOrderedMap<std::string>>();
+                                OffsetConcurrentMap<std::string>>();
                         }
                         break;
                     }
@@ -693,6 +742,12 @@ struct InsertRecord {
         return ack_responder_.GetAck();
     }
 
+    // bytes held by the pk index
+    int64_t
+    pk_index_mem_size() const {
+        return pk2offset_ != nullptr ? pk2offset_->mem_size() : 0;
+    }
+
     void
     clear() {
         timestamps_.clear();
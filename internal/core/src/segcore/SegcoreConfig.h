@@ -73,11 +73,59 @@ class SegcoreConfig {
         return enable_interim_segment_index_;
     }
 
+    void
+    set_growing_search_parallelism(int64_t parallelism) {
+        growing_search_parallelism_ = std::max<int64_t>(parallelism, 1);
+    }
+
+    int64_t
+    get_growing_search_parallelism() const {
+        return growing_search_parallelism_;
+    }
+
+    void
+    set_reduce_parallelism(int64_t parallelism) {
+        reduce_parallelism_ = std::max<int64_t>(parallelism, 1);
+    }
+
+    int64_t
+    get_reduce_parallelism() const {
+        return reduce_parallelism_;
+    }
+
+    void
+    set_group_by_parallelism(int64_t parallelism) {
+        group_by_parallelism_ = std::max<int64_t>(parallelism, 1);
+    }
+
+    int64_t
+    get_group_by_parallelism() const {
+        return group_by_parallelism_;
+    }
+
+    void
+    set_enable_varchar_pk_hash_index(bool enable) {
+        enable_varchar_pk_hash_index_ = enable;
+    }
+
+    bool
+    get_enable_varchar_pk_hash_index() const {
+        return enable_varchar_pk_hash_index_;
+    }
+
  private:
     inline static bool enable_interim_segment_index_ = false;
     inline static int64_t chunk_rows_ = 32 * 1024;
     inline static int64_t nlist_ = 100;
     inline static int64_t nprobe_ = 4;
+    // max tasks a single brute-force search on a growing segment fans out to
+    inline static int64_t growing_search_parallelism_ = 4;
+    // max tasks reducing the search results of one request fans out to
+    inline static int64_t reduce_parallelism_ = 4;
+    // max tasks the queries of one group-by search on a segment fan out to
+    inline static int64_t group_by_parallelism_ = 4;
+    // build a pk -> offsets hash for sorted sealed segments with varchar pk
+    inline static bool enable_varchar_pk_hash_index_ = false;
 };
 
 }  // namespace milvus::segcore
@@ -65,6 +65,44 @@ SegmentGrowingImpl::mask_with_delete(BitsetType& bitset,
     bitset |= delete_bitset;
 }
 
+int64_t
+SegmentGrowingImpl::get_masked_count(int64_t ins_barrier,
+                                     Timestamp timestamp) const {
+    auto del_barrier = get_barrier(get_deleted_record(), timestamp);
+    if (del_barrier == 0) {
+        return 0;
+    }
+    auto bitmap_holder = get_deleted_bitmap(
+        del_barrier, ins_barrier, deleted_record_, insert_record_, timestamp);
+    if (!bitmap_holder || !bitmap_holder->bitmap_ptr) {
+        return 0;
+    }
+    return bitmap_holder->bitmap_ptr->count();
+}
+
+std::vector<int64_t>
+SegmentGrowingImpl::get_masked_offsets(int64_t ins_barrier,
+                                       Timestamp timestamp) const {
+    // mask_with_timestamps does nothing for growing segments, only the
+    // deleted rows are masked out
+    std::vector<int64_t> offsets;
+    auto del_barrier = get_barrier(get_deleted_record(), timestamp);
+    if (del_barrier == 0) {
+        return offsets;
+    }
+    auto bitmap_holder = get_deleted_bitmap(
+        del_barrier, ins_barrier, deleted_record_, insert_record_, timestamp);
+    if (!bitmap_holder || !bitmap_holder->bitmap_ptr) {
+        return offsets;
+    }
+    auto& delete_bitset = *bitmap_holder->bitmap_ptr;
+    for (auto offset = delete_bitset.find_first(); offset.has_value();
+         offset = delete_bitset.find_next(offset.value())) {
+        offsets.push_back(offset.value());
+    }
+    return offsets;
+}
+
 void
 SegmentGrowingImpl::try_remove_chunks(FieldId fieldId) {
     //remove the chunk data to reduce memory consumption
@@ -210,7 +248,10 @@ SegmentGrowingImpl::LoadFieldData(const LoadFieldDataInfo& infos) {
                  field_id.get(),
                  num_rows);
         auto load_future =
-            pool.Submit(LoadFieldDatasFromRemote, insert_files, channel);
+            pool.Submit(LoadFieldDatasFromRemote,
+                        insert_files,
+                        channel,
+                        DEFAULT_FIELD_MAX_MEMORY_LIMIT);
 
         LOG_INFO("segment {} submits load field {} task to thread pool",
                  this->get_segment_id(),
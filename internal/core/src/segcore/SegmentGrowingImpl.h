@@ -138,7 +138,8 @@ class SegmentGrowingImpl : public SegmentGrowing {
  public:
     size_t
     GetMemoryUsageInBytes() const override {
-        return stats_.mem_size.load() + deleted_record_.mem_size();
+        return stats_.mem_size.load() + deleted_record_.mem_size() +
+               insert_record_.pk_index_mem_size();
     }
 
     int64_t
@@ -274,6 +275,13 @@ class SegmentGrowingImpl : public SegmentGrowing {
                      int64_t ins_barrier,
                      Timestamp timestamp) const override;
 
+    int64_t
+    get_masked_count(int64_t ins_barrier, Timestamp timestamp) const override;
+
+    std::vector<int64_t>
+    get_masked_offsets(int64_t ins_barrier,
+                       Timestamp timestamp) const override;
+
     std::pair<std::unique_ptr<IdArray>, std::vector<SegOffset>>
     search_ids(const IdArray& id_array, Timestamp timestamp) const override;
 
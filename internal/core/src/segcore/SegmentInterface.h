@@ -20,6 +20,7 @@
 #include <index/ScalarIndex.h>
 
 #include "DeletedRecord.h"
+#include "ExprResultCache.h"
 #include "FieldIndexing.h"
 #include "common/Schema.h"
 #include "common/Span.h"
@@ -223,9 +224,23 @@ class SegmentInternalInterface : public SegmentInterface {
     virtual bool
     HasIndex(FieldId field_id) const = 0;
 
+    // index on the values at `json_path` of a json field, nullptr if no such
+    // index has been loaded.
+    virtual const index::IndexBase*
+    GetJsonIndex(FieldId field_id, const std::string& json_path) const {
+        return nullptr;
+    }
+
     virtual bool
     HasFieldData(FieldId field_id) const = 0;
 
+    // cache of the filter results of this segment, nullptr if the segment
+    // doesn't cache them, see ExprResultCache.
+    virtual ExprResultCache*
+    get_expr_result_cache() const {
+        return nullptr;
+    }
+
     virtual std::string
     debug() const = 0;
 
@@ -273,6 +288,16 @@ class SegmentInternalInterface : public SegmentInterface {
                      int64_t ins_barrier,
                      Timestamp timestamp) const = 0;
 
+    // offsets below ins_barrier that mask_with_delete and
+    // mask_with_timestamps would mask out at the timestamp, in ascending
+    // order. Lets callers correct counts that are not derived from a bitset.
+    virtual std::vector<int64_t>
+    get_masked_offsets(int64_t ins_barrier, Timestamp timestamp) const = 0;
+
+    // number of offsets get_masked_offsets would return
+    virtual int64_t
+    get_masked_count(int64_t ins_barrier, Timestamp timestamp) const = 0;
+
     // count of chunk that has index available
     virtual int64_t
     num_chunk_index(FieldId field_id) const = 0;
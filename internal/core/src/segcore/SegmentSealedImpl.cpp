@@ -19,6 +19,8 @@
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -36,7 +38,9 @@
 #include "common/LoadInfo.h"
 #include "common/Tracer.h"
 #include "common/Types.h"
+#include "futures/Executor.h"
 #include "google/protobuf/message_lite.h"
+#include "index/Meta.h"
 #include "index/VectorMemIndex.h"
 #include "mmap/Column.h"
 #include "mmap/Utils.h"
@@ -79,6 +83,7 @@ SegmentSealedImpl::LoadIndex(const LoadIndexInfo& info) {
     } else {
         LoadScalarIndex(info);
     }
+    expr_result_cache_.Clear();
 }
 
 void
@@ -158,11 +163,49 @@ SegmentSealedImpl::WarmupChunkCache(const FieldId field_id, bool mmap_enabled) {
     }
 }
 
+void
+SegmentSealedImpl::LoadJsonIndex(
+    FieldId field_id,
+    const std::map<std::string, std::string>& index_params,
+    index::IndexBasePtr index) {
+    auto it = index_params.find(index::JSON_PATH);
+    AssertInfo(it != index_params.end(),
+               "json path is empty for json index of field {}",
+               field_id.get());
+    auto& json_path = it->second;
+
+    auto row_count = index->Count();
+    AssertInfo(row_count > 0, "Index count is 0");
+
+    std::unique_lock lck(mutex_);
+    if (num_rows_.has_value()) {
+        AssertInfo(num_rows_.value() == row_count,
+                   "json index of field ({}) path ({}) has different row "
+                   "count ({}) than other column's row count ({})",
+                   field_id.get(),
+                   json_path,
+                   row_count,
+                   num_rows_.value());
+    }
+    AssertInfo(json_indexings_[field_id].count(json_path) == 0,
+               "json index has been exist at field {} path {}",
+               field_id.get(),
+               json_path);
+    json_indexings_[field_id][json_path] = std::move(index);
+}
+
 void
 SegmentSealedImpl::LoadScalarIndex(const LoadIndexInfo& info) {
     // NOTE: lock only when data is ready to avoid starvation
     auto field_id = FieldId(info.field_id);
     auto& field_meta = schema_->operator[](field_id);
+    // the field keeps its raw data, a json index only covers one of its paths
+    if (field_meta.get_data_type() == DataType::JSON) {
+        LoadJsonIndex(field_id,
+                      info.index_params,
+                      std::move(const_cast<LoadIndexInfo&>(info).index));
+        return;
+    }
 
     auto row_count = info.index->Count();
     AssertInfo(row_count > 0, "Index count is 0");
@@ -236,52 +279,149 @@ SegmentSealedImpl::LoadScalarIndex(const LoadIndexInfo& info) {
 void
 SegmentSealedImpl::LoadFieldData(const LoadFieldDataInfo& load_info) {
     // NOTE: lock only when data is ready to avoid starvation
-    // only one field for now, parallel load field data in golang
     size_t num_rows = storage::GetNumRowsForLoadInfo(load_info);
 
+    std::vector<std::pair<FieldId, const FieldBinlogInfo*>> fields;
+    fields.reserve(load_info.field_infos.size());
     for (auto& [id, info] : load_info.field_infos) {
         AssertInfo(info.row_count > 0, "The row count of field data is 0");
+        fields.emplace_back(FieldId(id), &info);
+    }
 
-        auto field_id = FieldId(id);
-        auto insert_files = info.insert_files;
-        std::sort(insert_files.begin(),
-                  insert_files.end(),
-                  [](const std::string& a, const std::string& b) {
-                      return std::stol(a.substr(a.find_last_of('/') + 1)) <
-                             std::stol(b.substr(b.find_last_of('/') + 1));
-                  });
-
-        auto field_data_info =
-            FieldDataInfo(field_id.get(), num_rows, load_info.mmap_dir_path);
-        LOG_INFO("segment {} loads field {} with num_rows {}",
-                 this->get_segment_id(),
-                 field_id.get(),
-                 num_rows);
-
-        auto parallel_degree = static_cast<uint64_t>(
-            DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
-        field_data_info.channel->set_capacity(parallel_degree * 2);
-        auto& pool =
-            ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
-        pool.Submit(
-            LoadFieldDatasFromRemote, insert_files, field_data_info.channel);
-
-        LOG_INFO("segment {} submits load field {} task to thread pool",
+    if (fields.size() <= 1) {
+        for (auto& [field_id, info] : fields) {
+            LoadFieldDataFromBinlogs(field_id,
+                                     *info,
+                                     num_rows,
+                                     load_info.mmap_dir_path,
+                                     DEFAULT_FIELD_MAX_MEMORY_LIMIT);
+        }
+        return;
+    }
+
+    // load all fields concurrently, they share the memory budget of a single
+    // field load and become visible together once every field is in place
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::LOW);
+    auto parallelism = std::min<int64_t>(
+        fields.size(), static_cast<int64_t>(pool.GetMaxThreadNum()) + 1);
+    auto memory_budget = DEFAULT_FIELD_MAX_MEMORY_LIMIT / parallelism;
+    LOG_INFO("segment {} loads {} fields with parallelism {}",
+             this->get_segment_id(),
+             fields.size(),
+             parallelism);
+
+    BeginDeferFieldReady();
+    try {
+        // loads block on remote reads, keep them off the CPU executor
+        futures::ParallelForEach(
+            fields.size(),
+            parallelism,
+            [&pool](auto worker) { pool.Submit(std::move(worker)); },
+            [&](int64_t i) {
+                LoadFieldDataFromBinlogs(fields[i].first,
+                                         *fields[i].second,
+                                         num_rows,
+                                         load_info.mmap_dir_path,
+                                         memory_budget);
+            });
+    } catch (...) {
+        EndDeferFieldReady();
+        throw;
+    }
+    EndDeferFieldReady();
+}
+
+void
+SegmentSealedImpl::LoadFieldDataFromBinlogs(FieldId field_id,
+                                            const FieldBinlogInfo& info,
+                                            int64_t num_rows,
+                                            const std::string& mmap_dir_path,
+                                            int64_t memory_budget) {
+    if (CanLoadFieldDataInPlace(field_id, info)) {
+        LoadFieldDataInPlace(field_id, info, num_rows, memory_budget);
+        LOG_INFO("segment {} loads field {} in place done",
                  this->get_segment_id(),
                  field_id.get());
-        bool use_mmap = false;
-        if (!info.enable_mmap ||
-            SystemProperty::Instance().IsSystem(field_id)) {
-            LoadFieldData(field_id, field_data_info);
+        return;
+    }
+
+    auto insert_files = info.insert_files;
+    std::sort(insert_files.begin(),
+              insert_files.end(),
+              [](const std::string& a, const std::string& b) {
+                  return std::stol(a.substr(a.find_last_of('/') + 1)) <
+                         std::stol(b.substr(b.find_last_of('/') + 1));
+              });
+
+    auto field_data_info =
+        FieldDataInfo(field_id.get(), num_rows, mmap_dir_path);
+    LOG_INFO("segment {} loads field {} with num_rows {}",
+             this->get_segment_id(),
+             field_id.get(),
+             num_rows);
+
+    auto parallel_degree =
+        static_cast<uint64_t>(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
+    field_data_info.channel->set_capacity(parallel_degree * 2);
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    pool.Submit(LoadFieldDatasFromRemote,
+                insert_files,
+                field_data_info.channel,
+                memory_budget);
+
+    LOG_INFO("segment {} submits load field {} task to thread pool",
+             this->get_segment_id(),
+             field_id.get());
+    bool use_mmap = false;
+    if (!info.enable_mmap || SystemProperty::Instance().IsSystem(field_id)) {
+        LoadFieldData(field_id, field_data_info);
+    } else {
+        MapFieldData(field_id, field_data_info);
+        use_mmap = true;
+    }
+    LOG_INFO("segment {} loads field {} mmap {} done",
+             this->get_segment_id(),
+             field_id.get(),
+             use_mmap);
+}
+
+void
+SegmentSealedImpl::BeginDeferFieldReady() {
+    std::unique_lock lck(mutex_);
+    ++deferred_field_loads_;
+}
+
+void
+SegmentSealedImpl::EndDeferFieldReady() {
+    std::unique_lock lck(mutex_);
+    AssertInfo(deferred_field_loads_ > 0, "unbalanced deferred field load");
+    if (--deferred_field_loads_ > 0) {
+        return;
+    }
+    for (auto field_id : pending_ready_fields_) {
+        if (SystemProperty::Instance().IsSystem(field_id)) {
+            ++system_ready_count_;
         } else {
-            MapFieldData(field_id, field_data_info);
-            use_mmap = true;
+            set_bit(field_data_ready_bitset_, field_id, true);
         }
-        LOG_INFO("segment {} loads field {} mmap {} done",
-                 this->get_segment_id(),
-                 field_id.get(),
-                 use_mmap);
     }
+    pending_ready_fields_.clear();
+    expr_result_cache_.Clear();
+}
+
+void
+SegmentSealedImpl::PublishFieldReady(FieldId field_id) {
+    std::unique_lock lck(mutex_);
+    if (deferred_field_loads_ > 0) {
+        pending_ready_fields_.push_back(field_id);
+        return;
+    }
+    if (SystemProperty::Instance().IsSystem(field_id)) {
+        ++system_ready_count_;
+    } else {
+        set_bit(field_data_ready_bitset_, field_id, true);
+    }
+    expr_result_cache_.Clear();
 }
 
 void
@@ -324,7 +464,7 @@ SegmentSealedImpl::LoadFieldData(FieldId field_id, FieldDataInfo& data) {
             // Consume rowid field data but not really load it
             storage::CollectFieldDataChannel(data.channel);
         }
-        ++system_ready_count_;
+        PublishFieldReady(field_id);
     } else {
         // prepare data
         auto& field_meta = (*schema_)[field_id];
@@ -441,44 +581,121 @@ SegmentSealedImpl::LoadFieldData(FieldId field_id, FieldDataInfo& data) {
                                column->NumRows(),
                                num_rows));
 
-        {
-            std::unique_lock lck(mutex_);
-            fields_.emplace(field_id, column);
-        }
+        LoadFieldColumn(field_id, column, num_rows);
+    }
+    {
+        std::unique_lock lck(mutex_);
+        update_row_count(num_rows);
+    }
+}
 
-        // set pks to offset
-        // if the segments are already sorted by pk, there is no need to build a pk offset index.
-        // it can directly perform a binary search on the pk column.
-        if (schema_->get_primary_field_id() == field_id && !is_sorted_by_pk_) {
-            AssertInfo(field_id.get() != -1, "Primary key is -1");
-            AssertInfo(insert_record_.empty_pks(), "already exists");
-            insert_record_.insert_pks(data_type, column);
-            insert_record_.seal_pks();
-        }
+bool
+SegmentSealedImpl::CanLoadFieldDataInPlace(FieldId field_id,
+                                           const FieldBinlogInfo& info) const {
+    if (info.enable_mmap || SystemProperty::Instance().IsSystem(field_id)) {
+        return false;
+    }
+    auto data_type = (*schema_)[field_id].get_data_type();
+    if (IsVariableDataType(data_type)) {
+        return false;
+    }
+    // rows of each binlog must be known up front to place them in the column
+    if (info.insert_files.empty() ||
+        info.entries_nums.size() != info.insert_files.size()) {
+        return false;
+    }
+    return std::accumulate(info.entries_nums.begin(),
+                           info.entries_nums.end(),
+                           int64_t(0)) == info.row_count;
+}
 
-        bool use_temp_index = false;
-        {
-            // update num_rows to build temperate binlog index
-            std::unique_lock lck(mutex_);
-            update_row_count(num_rows);
-        }
+void
+SegmentSealedImpl::LoadFieldDataInPlace(FieldId field_id,
+                                        const FieldBinlogInfo& info,
+                                        int64_t num_rows,
+                                        int64_t memory_budget) {
+    auto& field_meta = (*schema_)[field_id];
+    auto data_type = field_meta.get_data_type();
 
-        if (generate_interim_index(field_id)) {
-            std::unique_lock lck(mutex_);
-            fields_.erase(field_id);
-            set_bit(field_data_ready_bitset_, field_id, false);
-            use_temp_index = true;
-        }
+    std::vector<size_t> order(info.insert_files.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto log_id = [&](size_t i) {
+        auto& file = info.insert_files[i];
+        return std::stol(file.substr(file.find_last_of('/') + 1));
+    };
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return log_id(a) < log_id(b);
+    });
+    std::vector<std::string> insert_files;
+    std::vector<int64_t> entries_nums;
+    insert_files.reserve(order.size());
+    entries_nums.reserve(order.size());
+    for (auto i : order) {
+        insert_files.push_back(info.insert_files[i]);
+        entries_nums.push_back(info.entries_nums[i]);
+    }
+
+    // the column is sized from the load info, binlogs are decoded into it
+    // directly so it's neither expanded nor copied from FieldData
+    auto column = std::make_shared<Column>(num_rows, field_meta);
+    column->ResizeForInPlaceLoad(num_rows);
+    LoadFieldDatasFromRemoteInPlace(
+        insert_files,
+        entries_nums,
+        storage::PayloadDecodeTarget{column->MutableData(),
+                                     column->MutableValidData(),
+                                     field_meta.get_sizeof(),
+                                     num_rows},
+        memory_budget);
+    stats_.mem_size += column->ByteSize();
+    LoadPrimitiveSkipIndex(field_id,
+                           0,
+                           data_type,
+                           column->Span().data(),
+                           column->Span().valid_data(),
+                           num_rows);
+
+    LoadFieldColumn(field_id, column, num_rows);
+}
 
-        if (!use_temp_index) {
-            std::unique_lock lck(mutex_);
-            set_bit(field_data_ready_bitset_, field_id, true);
-        }
+void
+SegmentSealedImpl::LoadFieldColumn(FieldId field_id,
+                                   const std::shared_ptr<ColumnBase>& column,
+                                   int64_t num_rows) {
+    auto data_type = (*schema_)[field_id].get_data_type();
+    {
+        std::unique_lock lck(mutex_);
+        fields_.emplace(field_id, column);
+    }
+
+    // set pks to offset
+    // if the segments are already sorted by pk, there is no need to build a pk offset index.
+    // it can directly perform a binary search on the pk column.
+    if (schema_->get_primary_field_id() == field_id && !is_sorted_by_pk_) {
+        AssertInfo(field_id.get() != -1, "Primary key is -1");
+        AssertInfo(insert_record_.empty_pks(), "already exists");
+        insert_record_.insert_pks(data_type, column);
+        insert_record_.seal_pks();
     }
+    build_varchar_pk_hash_index(field_id, column);
+
+    bool use_temp_index = false;
     {
+        // update num_rows to build temperate binlog index
         std::unique_lock lck(mutex_);
         update_row_count(num_rows);
     }
+
+    if (generate_interim_index(field_id)) {
+        std::unique_lock lck(mutex_);
+        fields_.erase(field_id);
+        set_bit(field_data_ready_bitset_, field_id, false);
+        use_temp_index = true;
+    }
+
+    if (!use_temp_index) {
+        PublishFieldReady(field_id);
+    }
 }
 
 void
@@ -582,9 +799,9 @@ SegmentSealedImpl::MapFieldData(const FieldId field_id, FieldDataInfo& data) {
         insert_record_.insert_pks(data_type, column);
         insert_record_.seal_pks();
     }
+    build_varchar_pk_hash_index(field_id, column);
 
-    std::unique_lock lck(mutex_);
-    set_bit(field_data_ready_bitset_, field_id, true);
+    PublishFieldReady(field_id);
 }
 
 void
@@ -755,6 +972,19 @@ SegmentSealedImpl::search_pk(const PkType& pk, Timestamp timestamp) const {
         case DataType::VARCHAR: {
             auto target = std::get<std::string>(pk);
             // get varchar pks
+            if (auto index = get_varchar_pk_hash_index(pk_column)) {
+                auto it = index->offsets.find(target);
+                if (it != index->offsets.end()) {
+                    auto [first, count] = it->second;
+                    for (auto offset = first; offset < first + count;
+                         ++offset) {
+                        if (insert_record_.timestamps_[offset] <= timestamp) {
+                            pk_offsets.emplace_back(offset);
+                        }
+                    }
+                }
+                break;
+            }
             auto var_column =
                 std::dynamic_pointer_cast<VariableColumn<std::string>>(
                     pk_column);
@@ -808,6 +1038,17 @@ SegmentSealedImpl::search_pk(const PkType& pk, int64_t insert_barrier) const {
         case DataType::VARCHAR: {
             auto target = std::get<std::string>(pk);
             // get varchar pks
+            if (auto index = get_varchar_pk_hash_index(pk_column)) {
+                auto it = index->offsets.find(target);
+                if (it != index->offsets.end()) {
+                    auto [first, count] = it->second;
+                    auto last = std::min(first + count, insert_barrier);
+                    for (auto offset = first; offset < last; ++offset) {
+                        pk_offsets.emplace_back(offset);
+                    }
+                }
+                break;
+            }
             auto var_column =
                 std::dynamic_pointer_cast<VariableColumn<std::string>>(
                     pk_column);
@@ -834,6 +1075,61 @@ SegmentSealedImpl::search_pk(const PkType& pk, int64_t insert_barrier) const {
     return pk_offsets;
 }
 
+void
+SegmentSealedImpl::build_varchar_pk_hash_index(
+    FieldId field_id, const std::shared_ptr<ColumnBase>& column) {
+    // a pk sorted segment searches pks on the column itself, build the index
+    // before the column is published so no query pays for it
+    if (schema_->get_primary_field_id() == field_id && is_sorted_by_pk_ &&
+        (*schema_)[field_id].get_data_type() == DataType::VARCHAR) {
+        get_varchar_pk_hash_index(column);
+    }
+}
+
+std::shared_ptr<const SegmentSealedImpl::VarcharPkHashIndex>
+SegmentSealedImpl::get_varchar_pk_hash_index(
+    const std::shared_ptr<ColumnBase>& pk_column) const {
+    if (!segcore_config_.get_enable_varchar_pk_hash_index()) {
+        return nullptr;
+    }
+
+    auto is_built =
+        [&](const std::shared_ptr<const VarcharPkHashIndex>& index) {
+            return index != nullptr && index->column.lock() == pk_column;
+        };
+    auto current = std::atomic_load(&varchar_pk_hash_index_);
+    if (is_built(current)) {
+        return current;
+    }
+
+    std::lock_guard<std::mutex> lck(varchar_pk_hash_index_mutex_);
+    current = std::atomic_load(&varchar_pk_hash_index_);
+    if (is_built(current)) {
+        return current;
+    }
+
+    auto var_column =
+        std::dynamic_pointer_cast<VariableColumn<std::string>>(pk_column);
+    AssertInfo(var_column != nullptr, "varchar pk column is not variable");
+    auto index = std::make_shared<VarcharPkHashIndex>();
+    index->column = pk_column;
+    // the column is sorted by pk, so duplicated pks are adjacent
+    auto views = var_column->Views();
+    auto num_rows = static_cast<int64_t>(views.size());
+    index->offsets.reserve(num_rows);
+    int64_t first = 0;
+    for (int64_t i = 1; i <= num_rows; ++i) {
+        if (i == num_rows || views[i] != views[first]) {
+            index->offsets.emplace(views[first],
+                                   std::make_pair(first, i - first));
+            first = i;
+        }
+    }
+    std::atomic_store(&varchar_pk_hash_index_,
+                      std::shared_ptr<const VarcharPkHashIndex>(index));
+    return index;
+}
+
 std::shared_ptr<DeletedRecord::TmpBitmap>
 SegmentSealedImpl::get_deleted_bitmap_s(int64_t del_barrier,
                                         int64_t insert_barrier,
@@ -867,6 +1163,7 @@ SegmentSealedImpl::get_deleted_bitmap_s(int64_t del_barrier,
 
     // Avoid invalid calculations when there are a lot of repeated delete pks
     std::unordered_map<PkType, Timestamp> delete_timestamps;
+    delete_timestamps.reserve(end - start);
     for (auto del_index = start; del_index < end; ++del_index) {
         auto pk = delete_record.pks()[del_index];
         auto timestamp = delete_record.timestamps()[del_index];
@@ -902,28 +1199,30 @@ SegmentSealedImpl::get_deleted_bitmap_s(int64_t del_barrier,
     return current;
 }
 
-void
-SegmentSealedImpl::mask_with_delete(BitsetType& bitset,
-                                    int64_t ins_barrier,
-                                    Timestamp timestamp) const {
+std::shared_ptr<DeletedRecord::TmpBitmap>
+SegmentSealedImpl::get_deleted_bitmap_at(int64_t ins_barrier,
+                                         Timestamp timestamp) const {
     auto del_barrier = get_barrier(get_deleted_record(), timestamp);
     if (del_barrier == 0) {
-        return;
+        return nullptr;
     }
 
-    auto bitmap_holder = std::shared_ptr<DeletedRecord::TmpBitmap>();
-
     if (!is_sorted_by_pk_) {
-        bitmap_holder = get_deleted_bitmap(del_barrier,
-                                           ins_barrier,
-                                           deleted_record_,
-                                           insert_record_,
-                                           timestamp);
-    } else {
-        bitmap_holder = get_deleted_bitmap_s(
-            del_barrier, ins_barrier, deleted_record_, timestamp);
-    }
+        return get_deleted_bitmap(del_barrier,
+                                  ins_barrier,
+                                  deleted_record_,
+                                  insert_record_,
+                                  timestamp);
+    }
+    return get_deleted_bitmap_s(
+        del_barrier, ins_barrier, deleted_record_, timestamp);
+}
 
+void
+SegmentSealedImpl::mask_with_delete(BitsetType& bitset,
+                                    int64_t ins_barrier,
+                                    Timestamp timestamp) const {
+    auto bitmap_holder = get_deleted_bitmap_at(ins_barrier, timestamp);
     if (!bitmap_holder || !bitmap_holder->bitmap_ptr) {
         return;
     }
@@ -937,6 +1236,69 @@ SegmentSealedImpl::mask_with_delete(BitsetType& bitset,
     bitset |= delete_bitset;
 }
 
+int64_t
+SegmentSealedImpl::get_masked_count(int64_t ins_barrier,
+                                    Timestamp timestamp) const {
+    auto bitmap_holder = get_deleted_bitmap_at(ins_barrier, timestamp);
+    const BitsetType* delete_bitset = nullptr;
+    int64_t count = 0;
+    if (bitmap_holder && bitmap_holder->bitmap_ptr) {
+        delete_bitset = bitmap_holder->bitmap_ptr.get();
+        count = delete_bitset->count();
+    }
+
+    if (insert_record_.timestamps_.num_chunk() == 0) {
+        return count;
+    }
+    auto timestamps_data =
+        (const milvus::Timestamp*)insert_record_.timestamps_.get_chunk_data(0);
+    auto [beg, end] =
+        insert_record_.timestamp_index_.get_active_range(timestamp);
+    // same rows as get_masked_offsets, without listing them
+    for (int64_t i = beg; i < ins_barrier; ++i) {
+        if ((i >= end || timestamps_data[i] > timestamp) &&
+            (delete_bitset == nullptr || !(*delete_bitset)[i])) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+std::vector<int64_t>
+SegmentSealedImpl::get_masked_offsets(int64_t ins_barrier,
+                                      Timestamp timestamp) const {
+    std::vector<int64_t> offsets;
+    auto bitmap_holder = get_deleted_bitmap_at(ins_barrier, timestamp);
+    const BitsetType* delete_bitset = nullptr;
+    if (bitmap_holder && bitmap_holder->bitmap_ptr) {
+        delete_bitset = bitmap_holder->bitmap_ptr.get();
+        for (auto offset = delete_bitset->find_first(); offset.has_value();
+             offset = delete_bitset->find_next(offset.value())) {
+            offsets.push_back(offset.value());
+        }
+    }
+
+    // rows of the active range inserted after the timestamp and every row
+    // past it, see mask_with_timestamps
+    if (insert_record_.timestamps_.num_chunk() == 0) {
+        return offsets;
+    }
+    auto timestamps_data =
+        (const milvus::Timestamp*)insert_record_.timestamps_.get_chunk_data(0);
+    auto [beg, end] =
+        insert_record_.timestamp_index_.get_active_range(timestamp);
+    auto num_deleted = offsets.size();
+    for (int64_t i = beg; i < ins_barrier; ++i) {
+        if ((i >= end || timestamps_data[i] > timestamp) &&
+            (delete_bitset == nullptr || !(*delete_bitset)[i])) {
+            offsets.push_back(i);
+        }
+    }
+    std::inplace_merge(
+        offsets.begin(), offsets.begin() + num_deleted, offsets.end());
+    return offsets;
+}
+
 void
 SegmentSealedImpl::vector_search(SearchInfo& search_info,
                                  const void* query_data,
@@ -986,7 +1348,10 @@ SegmentSealedImpl::vector_search(SearchInfo& search_info,
             get_bit(field_data_ready_bitset_, field_id),
             "Field Data is not loaded: " + std::to_string(field_id.get()));
         AssertInfo(num_rows_.has_value(), "Can't get row count value");
-        auto row_count = num_rows_.value();
+        // rows past the active count are newer than the query, brute force
+        // doesn't need to compute their distances at all
+        auto row_count =
+            std::min(num_rows_.value(), get_active_count(timestamp));
         auto vec_data = fields_.at(field_id);
         query::SearchOnSealed(*schema_,
                               vec_data->Data(),
@@ -994,7 +1359,7 @@ SegmentSealedImpl::vector_search(SearchInfo& search_info,
                               query_data,
                               query_count,
                               row_count,
-                              bitset,
+                              bitset.subview(0, row_count),
                               output);
         milvus::tracer::AddEvent("finish_searching_vector_data");
     }
@@ -1175,6 +1540,7 @@ SegmentSealedImpl::DropFieldData(const FieldId field_id) {
         }
         lck.unlock();
     }
+    expr_result_cache_.Clear();
 }
 
 void
@@ -1190,6 +1556,7 @@ SegmentSealedImpl::DropIndex(const FieldId field_id) {
     std::unique_lock lck(mutex_);
     vector_indexings_.drop_field_indexing(field_id);
     set_bit(index_ready_bitset_, field_id, false);
+    expr_result_cache_.Clear();
 }
 
 void
@@ -1376,12 +1743,16 @@ SegmentSealedImpl::ClearData() {
         system_ready_count_ = 0;
         num_rows_ = std::nullopt;
         scalar_indexings_.clear();
+        json_indexings_.clear();
         vector_indexings_.clear();
         insert_record_.clear();
         fields_.clear();
         variable_fields_avg_size_.clear();
+        std::atomic_store(&varchar_pk_hash_index_,
+                          std::shared_ptr<const VarcharPkHashIndex>());
         stats_.mem_size = 0;
     }
+    expr_result_cache_.Clear();
     auto cc = storage::MmapManager::GetInstance().GetChunkCache();
     if (cc == nullptr) {
         return;
@@ -1650,6 +2021,21 @@ SegmentSealedImpl::HasIndex(FieldId field_id) const {
            get_bit(binlog_index_bitset_, field_id);
 }
 
+const index::IndexBase*
+SegmentSealedImpl::GetJsonIndex(FieldId field_id,
+                                const std::string& json_path) const {
+    std::shared_lock lck(mutex_);
+    auto field_it = json_indexings_.find(field_id);
+    if (field_it == json_indexings_.end()) {
+        return nullptr;
+    }
+    auto it = field_it->second.find(json_path);
+    if (it == field_it->second.end()) {
+        return nullptr;
+    }
+    return it->second.get();
+}
+
 bool
 SegmentSealedImpl::HasFieldData(FieldId field_id) const {
     std::shared_lock lck(mutex_);
@@ -1751,17 +2137,19 @@ SegmentSealedImpl::find_first(int64_t limit, const BitsetType& bitset) const {
     std::vector<int64_t> seg_offsets;
     seg_offsets.reserve(limit);
 
+    // offsets past the bitset won't happen on sealed segments, but keep
+    // the search within both bounds anyway.
+    auto end = std::min(int64_t(size), num_rows_.value());
     int64_t offset = 0;
-    for (; hit_num < limit && offset < num_rows_.value(); offset++) {
-        if (offset >= size) {
-            // In fact, this case won't happen on sealed segments.
-            continue;
-        }
-
-        if (!bitset[offset]) {
-            seg_offsets.push_back(offset);
-            hit_num++;
-        }
+    auto next = end > 0 ? bitset.find_first_unset() : std::nullopt;
+    while (hit_num < limit && next.has_value() && int64_t(*next) < end) {
+        seg_offsets.push_back(*next);
+        hit_num++;
+        offset = *next + 1;
+        next = bitset.find_next_unset(*next);
+    }
+    if (hit_num < limit) {
+        offset = num_rows_.value();
     }
 
     return {seg_offsets, more_hit_than_limit && offset != num_rows_.value()};
@@ -1836,8 +2224,12 @@ SegmentSealedImpl::LoadSegmentMeta(
 
 int64_t
 SegmentSealedImpl::get_active_count(Timestamp ts) const {
-    // TODO optimize here to reduce expr search range
-    return this->get_row_count();
+    if (insert_record_.timestamps_.empty()) {
+        return this->get_row_count();
+    }
+    // rows from the end of the active range on are all newer than ts, so
+    // filters and searches never need to look at them
+    return insert_record_.timestamp_index_.get_active_range(ts).second;
 }
 
 void
@@ -1854,24 +2246,29 @@ SegmentSealedImpl::mask_with_timestamps(BitsetType& bitset_chunk,
                fmt::format("Timestamp size not equal to row count: {}, {}",
                            timestamps_data_size,
                            get_row_count()));
-    auto range = insert_record_.timestamp_index_.get_active_range(timestamp);
-
-    // range == (size_, size_) and size_ is this->timestamps_.size().
-    // it means these data are all useful, we don't need to update bitset_chunk.
-    // It can be thought of as an OR operation with another bitmask that is all 0s, but it is not necessary to do so.
-    if (range.first == range.second && range.first == timestamps_data_size) {
-        // just skip
-        return;
-    }
-    // range == (0, 0). it means these data can not be used, directly set bitset_chunk to all 1s.
-    // It can be thought of as an OR operation with another bitmask that is all 1s.
-    if (range.first == range.second && range.first == 0) {
-        bitset_chunk.set();
-        return;
+    auto [beg, end] =
+        insert_record_.timestamp_index_.get_active_range(timestamp);
+    // the bitset may only cover the active count, rows [0, beg) are all
+    // visible and rows [end, size) all invisible, so only the rows in
+    // between need their timestamp checked.
+    auto bitset_size = static_cast<int64_t>(bitset_chunk.size());
+    auto checked_end = std::min(end, bitset_size);
+    if (beg < checked_end) {
+        // mask out the rows inserted after the query timestamp in place,
+        // without materializing a separate timestamp bitset
+        bitset_chunk.view(beg, checked_end - beg)
+            .inplace_or_compare_val<Timestamp,
+                                    milvus::bitset::CompareOpType::GT>(
+                timestamps_data + beg, checked_end - beg, timestamp);
+    }
+    if (end < bitset_size) {
+        bitset_chunk.view(end).set();
+    }
+    // rows past the active count were never evaluated, they are masked out
+    // here so the bitset covers every row for the vector indexes.
+    if (bitset_size < timestamps_data_size) {
+        bitset_chunk.resize(timestamps_data_size, true);
     }
-    auto mask = TimestampIndex::GenerateBitset(
-        timestamp, range, timestamps_data, timestamps_data_size);
-    bitset_chunk |= mask;
 }
 
 bool
@@ -17,7 +17,9 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -64,6 +66,15 @@ class SegmentSealedImpl : public SegmentSealed {
     bool
     HasFieldData(FieldId field_id) const override;
 
+    const index::IndexBase*
+    GetJsonIndex(FieldId field_id,
+                 const std::string& json_path) const override;
+
+    ExprResultCache*
+    get_expr_result_cache() const override {
+        return &expr_result_cache_;
+    }
+
     bool
     Contain(const PkType& pk) const override {
         return insert_record_.contain(pk);
@@ -112,12 +123,37 @@ class SegmentSealedImpl : public SegmentSealed {
     std::vector<SegOffset>
     search_pk(const PkType& pk, int64_t insert_barrier) const;
 
+    // pk -> [first offset, row count) of a varchar pk column sorted by pk
+    struct VarcharPkHashIndex {
+        std::weak_ptr<ColumnBase> column;
+        std::unordered_map<std::string_view, std::pair<int64_t, int64_t>>
+            offsets;
+    };
+
+    // returns nullptr if the hash index is disabled, otherwise the index of
+    // pk_column. It's built when the pk column is loaded, and rebuilt here
+    // if the pk column has been reloaded since.
+    std::shared_ptr<const VarcharPkHashIndex>
+    get_varchar_pk_hash_index(
+        const std::shared_ptr<ColumnBase>& pk_column) const;
+
+    // builds the hash index if column is the varchar pk of a pk sorted
+    // segment and the hash index is enabled
+    void
+    build_varchar_pk_hash_index(FieldId field_id,
+                                const std::shared_ptr<ColumnBase>& column);
+
     std::shared_ptr<DeletedRecord::TmpBitmap>
     get_deleted_bitmap_s(int64_t del_barrier,
                          int64_t insert_barrier,
                          DeletedRecord& delete_record,
                          Timestamp query_timestamp) const;
 
+    // the cached deleted bitmap sized ins_barrier, or nullptr if nothing
+    // has been deleted before the timestamp
+    std::shared_ptr<DeletedRecord::TmpBitmap>
+    get_deleted_bitmap_at(int64_t ins_barrier, Timestamp timestamp) const;
+
     std::unique_ptr<DataArray>
     get_vector(FieldId field_id, const int64_t* ids, int64_t count) const;
 
@@ -284,6 +320,13 @@ class SegmentSealedImpl : public SegmentSealed {
                      int64_t ins_barrier,
                      Timestamp timestamp) const override;
 
+    int64_t
+    get_masked_count(int64_t ins_barrier, Timestamp timestamp) const override;
+
+    std::vector<int64_t>
+    get_masked_offsets(int64_t ins_barrier,
+                       Timestamp timestamp) const override;
+
     bool
     is_system_field_ready() const {
         return system_ready_count_ == 2;
@@ -306,12 +349,55 @@ class SegmentSealedImpl : public SegmentSealed {
     void
     LoadScalarIndex(const LoadIndexInfo& info);
 
+    // takes over the index, the same way LoadScalarIndex takes over the
+    // index of a scalar field
+    void
+    LoadJsonIndex(FieldId field_id,
+                  const std::map<std::string, std::string>& index_params,
+                  index::IndexBasePtr index);
+
     void
     WarmupChunkCache(const FieldId field_id, bool mmap_enabled) override;
 
     bool
     generate_interim_index(const FieldId field_id);
 
+    void
+    LoadFieldDataFromBinlogs(FieldId field_id,
+                             const FieldBinlogInfo& info,
+                             int64_t num_rows,
+                             const std::string& mmap_dir_path,
+                             int64_t memory_budget);
+
+    // while a multi-field load is in progress, loaded fields are kept
+    // invisible and published together when the last such load ends
+    void
+    BeginDeferFieldReady();
+
+    void
+    EndDeferFieldReady();
+
+    void
+    PublishFieldReady(FieldId field_id);
+
+    // whether the binlogs of the field can be decoded straight into a
+    // pre-sized column, skipping the intermediate FieldData
+    bool
+    CanLoadFieldDataInPlace(FieldId field_id,
+                            const FieldBinlogInfo& info) const;
+
+    // memory_budget bounds the bytes of binlogs fetched but not yet decoded
+    void
+    LoadFieldDataInPlace(FieldId field_id,
+                         const FieldBinlogInfo& info,
+                         int64_t num_rows,
+                         int64_t memory_budget);
+
+    void
+    LoadFieldColumn(FieldId field_id,
+                    const std::shared_ptr<ColumnBase>& column,
+                    int64_t num_rows);
+
  private:
     // mmap descriptor, used in chunk cache
     storage::MmapChunkDescriptorPtr mmap_descriptor_ = nullptr;
@@ -320,6 +406,9 @@ class SegmentSealedImpl : public SegmentSealed {
     BitsetType index_ready_bitset_;
     BitsetType binlog_index_bitset_;
     std::atomic<int> system_ready_count_ = 0;
+    // guarded by mutex_, see BeginDeferFieldReady
+    int deferred_field_loads_ = 0;
+    std::vector<FieldId> pending_ready_fields_;
     // segment data
 
     // TODO: generate index for scalar
@@ -327,6 +416,10 @@ class SegmentSealedImpl : public SegmentSealed {
 
     // scalar field index
     std::unordered_map<FieldId, index::IndexBasePtr> scalar_indexings_;
+    // json path index, keyed by field and json pointer of the path
+    std::unordered_map<FieldId,
+                       std::unordered_map<std::string, index::IndexBasePtr>>
+        json_indexings_;
     // vector field index
     SealedIndexingRecord vector_indexings_;
 
@@ -357,6 +450,14 @@ class SegmentSealedImpl : public SegmentSealed {
 
     // whether the segment is sorted by the pk
     bool is_sorted_by_pk_ = false;
+
+    // readers load varchar_pk_hash_index_ by std::atomic_load without any
+    // lock, the mutex only serializes the building of a new index
+    mutable std::mutex varchar_pk_hash_index_mutex_;
+    mutable std::shared_ptr<const VarcharPkHashIndex> varchar_pk_hash_index_;
+
+    // cleared whenever a field or an index is loaded or dropped
+    mutable ExprResultCache expr_result_cache_;
 };
 
 inline SegmentSealedUPtr
@@ -76,11 +76,11 @@ TimestampIndex::GenerateBitset(Timestamp query_timestamp,
     Assert(beg < end);
     BitsetType bitset;
     bitset.reserve(size);
-    bitset.resize(beg, false);
+    bitset.resize(end, false);
     bitset.resize(size, true);
-    for (int64_t i = beg; i < end; ++i) {
-        bitset[i] = timestamps[i] > query_timestamp;
-    }
+    bitset.view(beg, end - beg)
+        .inplace_or_compare_val<Timestamp, milvus::bitset::CompareOpType::GT>(
+            timestamps + beg, end - beg, query_timestamp);
     return bitset;
 }
 
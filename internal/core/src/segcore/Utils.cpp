@@ -11,9 +11,14 @@
 
 #include "segcore/Utils.h"
 
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <future>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "common/Common.h"
@@ -22,6 +27,7 @@
 #include "index/ScalarIndex.h"
 #include "mmap/Utils.h"
 #include "log/Log.h"
+#include "monitor/prometheus_client.h"
 #include "storage/RemoteChunkManagerSingleton.h"
 #include "storage/ThreadPools.h"
 #include "storage/Util.h"
@@ -785,37 +791,254 @@ ReverseDataFromIndex(const index::IndexBase* index,
 // segcore use default remote chunk manager to load data from minio/s3
 void
 LoadFieldDatasFromRemote(const std::vector<std::string>& remote_files,
-                         FieldDataChannelPtr channel) {
-    try {
-        auto rcm = storage::RemoteChunkManagerSingleton::GetInstance()
-                       .GetRemoteChunkManager();
-        auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::HIGH);
+                         FieldDataChannelPtr channel,
+                         int64_t memory_budget) {
+    auto rcm = storage::RemoteChunkManagerSingleton::GetInstance()
+                   .GetRemoteChunkManager();
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::HIGH);
+    // bytes committed to the window: reserved when a fetch is submitted,
+    // corrected to the decoded size once it completes, released when the
+    // rows are handed to the channel
+    std::atomic<int64_t> inflight_bytes{0};
+    // largest footprint of a binlog fetched so far, the reservation of every
+    // later fetch. Binlogs of a field are cut to similar sizes.
+    std::atomic<int64_t> max_file_bytes{0};
+    // pending fetches with the bytes reserved for them
+    std::deque<std::pair<std::future<std::pair<FieldDataPtr, int64_t>>,
+                         int64_t>>
+        window;
 
-        std::vector<std::future<FieldDataPtr>> futures;
-        futures.reserve(remote_files.size());
-        for (const auto& file : remote_files) {
-            auto future = pool.Submit([&]() {
-                auto fileSize = rcm->Size(file);
-                auto buf = std::shared_ptr<uint8_t[]>(new uint8_t[fileSize]);
-                rcm->Read(file, buf.get(), fileSize);
-                auto result = storage::DeserializeFileData(buf, fileSize);
-                return result->GetFieldData();
-            });
-            futures.emplace_back(std::move(future));
+    auto reserve = [&](int64_t size) {
+        inflight_bytes += size;
+        monitor::internal_storage_load_inflight_bytes_field_data.Increment(
+            size);
+    };
+    auto release = [&](int64_t size) {
+        inflight_bytes -= size;
+        monitor::internal_storage_load_inflight_bytes_field_data.Decrement(
+            size);
+    };
+    auto fetch = [&](const std::string& file, int64_t reserved) {
+        auto [buf, file_size] = rcm->ReadAll(file);
+        int64_t raw_size = file_size;
+        auto field_data =
+            storage::DeserializeFileData(buf, raw_size)->GetFieldData();
+        // the raw binlog is released here, only the decoded rows stay
+        int64_t data_size = field_data->Size();
+        auto footprint = std::max(raw_size, data_size);
+        auto max_bytes = max_file_bytes.load();
+        while (footprint > max_bytes &&
+               !max_file_bytes.compare_exchange_weak(max_bytes, footprint)) {
         }
+        reserve(data_size - reserved);
+        return std::make_pair(field_data, data_size);
+    };
+
+    try {
+        // binlogs are fetched in a window bounded by the pool size and the
+        // memory budget, then handed to the channel in order. A slow
+        // consumer blocks the push, which in turn stops the window from
+        // moving forward. Until the first binlog is fetched its size is
+        // unknown, so it is fetched alone.
+        auto max_window = std::max<size_t>(pool.GetMaxThreadNum(), 1);
+        size_t next = 0;
+        while (next < remote_files.size() || !window.empty()) {
+            while (next < remote_files.size() && window.size() < max_window) {
+                auto reserved = max_file_bytes.load();
+                if (!window.empty() &&
+                    (reserved == 0 ||
+                     inflight_bytes.load() + reserved > memory_budget)) {
+                    break;
+                }
+                reserve(reserved);
+                window.emplace_back(
+                    pool.Submit(fetch, remote_files[next++], reserved),
+                    reserved);
+            }
 
-        for (auto& future : futures) {
-            auto field_data = future.get();
-            channel->push(field_data);
+            auto [future, reserved] = std::move(window.front());
+            window.pop_front();
+            std::pair<FieldDataPtr, int64_t> fetched;
+            try {
+                fetched = future.get();
+            } catch (...) {
+                release(reserved);
+                throw;
+            }
+            auto start = std::chrono::steady_clock::now();
+            channel->push(fetched.first);
+            monitor::internal_storage_queue_wait_duration.Observe(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count());
+            release(fetched.second);
         }
 
         channel->close();
     } catch (std::exception& e) {
         LOG_INFO("failed to load data from remote: {}", e.what());
+        // the fetching tasks reference the local state, wait for all of them
+        for (auto& [future, reserved] : window) {
+            try {
+                release(future.get().second);
+            } catch (...) {
+                release(reserved);
+            }
+        }
         channel->close(std::current_exception());
     }
 }
 
+void
+LoadFieldDatasFromRemoteInPlace(const std::vector<std::string>& remote_files,
+                                const std::vector<int64_t>& entries_nums,
+                                const storage::PayloadDecodeTarget& target,
+                                int64_t memory_budget) {
+    AssertInfo(remote_files.size() == entries_nums.size(),
+               "inconsistent size of binlogs {} and entries nums {}",
+               remote_files.size(),
+               entries_nums.size());
+    auto total_rows =
+        std::accumulate(entries_nums.begin(), entries_nums.end(), int64_t(0));
+    AssertInfo(total_rows <= target.capacity,
+               "binlogs have {} rows, more than expected {}",
+               total_rows,
+               target.capacity);
+    auto rcm = storage::RemoteChunkManagerSingleton::GetInstance()
+                   .GetRemoteChunkManager();
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::HIGH);
+
+    // bytes of raw binlogs committed to the window: a binlog reserves the
+    // size of its decoded rows when it's submitted, corrected to the size of
+    // the fetched file, and releases it once the rows are in place
+    std::atomic<int64_t> inflight_bytes{0};
+    auto reserve = [&](int64_t size) {
+        inflight_bytes += size;
+        monitor::internal_storage_load_inflight_bytes_field_data.Increment(
+            size);
+    };
+    auto release = [&](int64_t size) {
+        inflight_bytes -= size;
+        monitor::internal_storage_load_inflight_bytes_field_data.Decrement(
+            size);
+    };
+    auto row_bytes = static_cast<int64_t>(target.row_size) +
+                     (target.valid_data == nullptr ? 0 : 1);
+
+    auto fetch_and_decode = [&](const std::string& file,
+                                storage::PayloadDecodeTarget file_target,
+                                int64_t reserved) {
+        std::shared_ptr<uint8_t[]> buf;
+        int64_t file_size = 0;
+        try {
+            std::tie(buf, file_size) = rcm->ReadAll(file);
+        } catch (...) {
+            release(reserved);
+            throw;
+        }
+        reserve(file_size - reserved);
+        int64_t num_rows = 0;
+        try {
+            num_rows =
+                storage::DeserializeFileDataInto(buf, file_size, file_target);
+        } catch (...) {
+            release(file_size);
+            throw;
+        }
+        // the raw binlog is released here, the rows are in place already
+        buf.reset();
+        release(file_size);
+        return num_rows;
+    };
+    // only the footer and one window of column chunks of the binlog are
+    // held at a time, the window is reserved for the whole decoding
+    auto decode_by_range = [&](const std::string& file,
+                               storage::PayloadDecodeTarget file_target,
+                               int64_t reserved) {
+        int64_t num_rows = 0;
+        try {
+            num_rows = storage::DownloadAndDecodeRemoteFileInto(
+                rcm, file, file_target, DEFAULT_RANGED_DECODE_WINDOW_SIZE);
+        } catch (...) {
+            release(reserved);
+            throw;
+        }
+        release(reserved);
+        return num_rows;
+    };
+    auto load_file = [&](const std::string& file,
+                         storage::PayloadDecodeTarget file_target,
+                         int64_t reserved,
+                         bool by_range) {
+        auto num_rows = by_range
+                            ? decode_by_range(file, file_target, reserved)
+                            : fetch_and_decode(file, file_target, reserved);
+        AssertInfo(num_rows == file_target.capacity,
+                   "binlog {} has {} rows, but entries num is {}",
+                   file,
+                   num_rows,
+                   file_target.capacity);
+    };
+
+    // fetches are kept in a window bounded by the pool size and the memory
+    // budget, each is waited for in order and its buffer is gone once the
+    // future completes. The window always admits one fetch so a binlog
+    // larger than the budget still loads.
+    auto max_window = std::max<size_t>(pool.GetMaxThreadNum(), 1);
+    std::deque<std::future<void>> window;
+    int64_t offset = 0;
+    size_t next = 0;
+    std::exception_ptr first_exception;
+    while (next < remote_files.size() || !window.empty()) {
+        while (!first_exception && next < remote_files.size() &&
+               window.size() < max_window) {
+            // a binlog larger than a decode window is fetched by ranges, so
+            // it never holds more than the window
+            auto reserved = entries_nums[next] * row_bytes;
+            auto by_range = reserved > DEFAULT_RANGED_DECODE_WINDOW_SIZE;
+            if (by_range) {
+                reserved = DEFAULT_RANGED_DECODE_WINDOW_SIZE;
+            }
+            if (!window.empty() &&
+                inflight_bytes.load() + reserved > memory_budget) {
+                break;
+            }
+            storage::PayloadDecodeTarget file_target{
+                target.data + offset * target.row_size,
+                target.valid_data == nullptr ? nullptr
+                                             : target.valid_data + offset,
+                target.row_size,
+                entries_nums[next]};
+            reserve(reserved);
+            window.emplace_back(pool.Submit(load_file,
+                                            remote_files[next],
+                                            file_target,
+                                            reserved,
+                                            by_range));
+            offset += entries_nums[next];
+            ++next;
+        }
+        if (window.empty()) {
+            break;
+        }
+
+        // every task writes into target, so the ones already submitted are
+        // waited for before reporting the first failure
+        auto future = std::move(window.front());
+        window.pop_front();
+        try {
+            future.get();
+        } catch (...) {
+            if (!first_exception) {
+                first_exception = std::current_exception();
+            }
+        }
+    }
+    if (first_exception) {
+        std::rethrow_exception(first_exception);
+    }
+}
+
 int64_t
 upper_bound(const ConcurrentVector<Timestamp>& timestamps,
             int64_t first,
@@ -28,6 +28,7 @@
 #include "log/Log.h"
 #include "segcore/DeletedRecord.h"
 #include "segcore/InsertRecord.h"
+#include "storage/PayloadReader.h"
 
 namespace milvus::segcore {
 
@@ -100,7 +101,9 @@ struct MergeBase {
 
     milvus::DataArray*
     get_field_data(FieldId fieldId) const {
-        return (*output_fields_data_)[fieldId].get();
+        // lookup only, slices of one result are marshaled concurrently
+        auto it = output_fields_data_->find(fieldId);
+        return it == output_fields_data_->end() ? nullptr : it->second.get();
     }
 };
 
@@ -184,9 +187,22 @@ ReverseDataFromIndex(const index::IndexBase* index,
                      int64_t count,
                      const FieldMeta& field_meta);
 
+// memory_budget bounds the bytes fetched but not yet handed to channel
 void
 LoadFieldDatasFromRemote(const std::vector<std::string>& remote_files,
-                         FieldDataChannelPtr channel);
+                         FieldDataChannelPtr channel,
+                         int64_t memory_budget);
+
+// Decode fixed-width insert binlogs straight into target, the rows of
+// remote_files[i] start right after the entries_nums of the files before it.
+// memory_budget bounds the bytes of binlogs fetched but not yet decoded,
+// binlogs larger than DEFAULT_RANGED_DECODE_WINDOW_SIZE are fetched by
+// ranged reads of their column chunks instead of as a whole.
+void
+LoadFieldDatasFromRemoteInPlace(const std::vector<std::string>& remote_files,
+                                const std::vector<int64_t>& entries_nums,
+                                const storage::PayloadDecodeTarget& target,
+                                int64_t memory_budget);
 
 /**
  * Returns an index pointing to the first element in the range [first, last) such that `value < element` is true
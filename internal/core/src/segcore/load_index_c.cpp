@@ -272,6 +272,15 @@ AppendIndexV2(CTraceContext c_trace, CLoadIndexInfo c_load_index_info) {
             load_index_info->index_params);
         config[milvus::index::INDEX_FILES] = load_index_info->index_files;
 
+        if (field_type == milvus::DataType::JSON) {
+            index_info.json_path =
+                milvus::index::GetValueFromConfig<std::string>(
+                    config, milvus::index::JSON_PATH)
+                    .value_or("");
+            index_info.json_cast_type =
+                milvus::index::GetJsonCastTypeFromConfig(config);
+        }
+
         milvus::storage::FileManagerContext fileManagerContext(
             field_meta, index_meta, remote_chunk_manager);
         load_index_info->index =
@@ -102,14 +102,16 @@ GroupReduceHelper::FilterInvalidSearchResult(SearchResult* search_result) {
 int64_t
 GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
                                               int64_t topk,
-                                              int64_t& offset) {
+                                              NQReduceScratch& scratch) {
     std::priority_queue<SearchResultPair*,
                         std::vector<SearchResultPair*>,
                         SearchResultPairComparator>
         heap;
-    pk_set_.clear();
-    pairs_.clear();
-    pairs_.reserve(num_segments_);
+    auto& pk_set = scratch.pk_set;
+    auto& pairs = scratch.pairs;
+    pk_set.clear();
+    pairs.clear();
+    pairs.reserve(num_segments_);
     for (int i = 0; i < num_segments_; i++) {
         auto search_result = search_results_[i];
         auto offset_beg = search_result->topk_per_nq_prefix_sum_[qi];
@@ -127,14 +129,14 @@ GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
                    "Wrong state, search_result's group_by_values's length is "
                    "not equal to pks' size!");
         auto group_by_val = search_result->group_by_values_.value()[offset_beg];
-        pairs_.emplace_back(primary_key,
+        pairs.emplace_back(primary_key,
                             distance,
                             search_result,
                             i,
                             offset_beg,
                             offset_end,
                             std::move(group_by_val));
-        heap.push(&pairs_.back());
+        heap.push(&pairs.back());
     }
 
     // nq has no results for all segments
@@ -145,12 +147,12 @@ GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
     int64_t group_size = search_results_[0]->group_size_.value();
     int64_t group_by_total_size = group_size * topk;
     int64_t filtered_count = 0;
-    auto start = offset;
+    auto& result_segments = nq_result_segments_[qi];
     std::unordered_map<GroupByValueType, int64_t> group_by_map;
 
     auto should_filtered = [&](const PkType& pk,
                                const GroupByValueType& group_by_val) {
-        if (pk_set_.count(pk) != 0)
+        if (pk_set.count(pk) != 0)
             return true;
         if (group_by_map.size() >= topk &&
             group_by_map.count(group_by_val) == 0)
@@ -160,7 +162,8 @@ GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
         return false;
     };
 
-    while (offset - start < group_by_total_size && !heap.empty()) {
+    while (int64_t(result_segments.size()) < group_by_total_size &&
+           !heap.empty()) {
         //fetch value
         auto pilot = heap.top();
         heap.pop();
@@ -173,9 +176,9 @@ GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
 
         //judge filter
         if (!should_filtered(pk, group_by_val)) {
-            pilot->search_result_->result_offsets_.push_back(offset++);
+            result_segments.push_back(index);
             final_search_records_[index][qi].push_back(pilot->offset_);
-            pk_set_.insert(pk);
+            pk_set.insert(pk);
             group_by_map[group_by_val] += 1;
         } else {
             filtered_count++;
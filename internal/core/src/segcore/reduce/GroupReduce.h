@@ -37,7 +37,7 @@ class GroupReduceHelper : public ReduceHelper {
     int64_t
     ReduceSearchResultForOneNQ(int64_t qi,
                                int64_t topk,
-                               int64_t& result_offset) override;
+                               NQReduceScratch& scratch) override;
 
     void
     RefreshSingleSearchResult(SearchResult* search_result,
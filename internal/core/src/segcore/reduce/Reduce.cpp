@@ -12,9 +12,12 @@
 #include "Reduce.h"
 
 #include "log/Log.h"
+#include <atomic>
 #include <cstdint>
 #include <vector>
 
+#include "futures/Executor.h"
+#include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/Utils.h"
 #include "common/EasyAssert.h"
@@ -50,6 +53,7 @@ ReduceHelper::Initialize() {
     for (auto& search_record : final_search_records_) {
         search_record.resize(total_nq_);
     }
+    nq_result_segments_.resize(total_nq_);
 }
 
 void
@@ -67,10 +71,11 @@ ReduceHelper::Marshal() {
     search_result_data_blobs_ =
         std::make_unique<milvus::segcore::SearchResultDataBlobs>();
     search_result_data_blobs_->blobs.resize(num_slices_);
-    for (int i = 0; i < num_slices_; i++) {
-        auto proto = GetSearchResultDataSlice(i);
-        search_result_data_blobs_->blobs[i] = proto;
-    }
+    auto parallelism =
+        SegcoreConfig::default_config().get_reduce_parallelism();
+    futures::ParallelForEach(num_slices_, parallelism, [&](int64_t i) {
+        search_result_data_blobs_->blobs[i] = GetSearchResultDataSlice(i);
+    });
 }
 
 void
@@ -195,15 +200,17 @@ ReduceHelper::FillEntryData() {
 int64_t
 ReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
                                          int64_t topk,
-                                         int64_t& offset) {
+                                         NQReduceScratch& scratch) {
     std::priority_queue<SearchResultPair*,
                         std::vector<SearchResultPair*>,
                         SearchResultPairComparator>
         heap;
-    pk_set_.clear();
-    pairs_.clear();
+    auto& pk_set = scratch.pk_set;
+    auto& pairs = scratch.pairs;
+    pk_set.clear();
+    pairs.clear();
 
-    pairs_.reserve(num_segments_);
+    pairs.reserve(num_segments_);
     for (int i = 0; i < num_segments_; i++) {
         auto search_result = search_results_[i];
         auto offset_beg = search_result->topk_per_nq_prefix_sum_[qi];
@@ -213,9 +220,9 @@ ReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
         }
         auto primary_key = search_result->primary_keys_[offset_beg];
         auto distance = search_result->distances_[offset_beg];
-        pairs_.emplace_back(
+        pairs.emplace_back(
             primary_key, distance, search_result, i, offset_beg, offset_end);
-        heap.push(&pairs_.back());
+        heap.push(&pairs.back());
     }
 
     // nq has no results for all segments
@@ -224,8 +231,8 @@ ReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
     }
 
     int64_t dup_cnt = 0;
-    auto start = offset;
-    while (offset - start < topk && !heap.empty()) {
+    auto& result_segments = nq_result_segments_[qi];
+    while (int64_t(result_segments.size()) < topk && !heap.empty()) {
         auto pilot = heap.top();
         heap.pop();
 
@@ -236,10 +243,10 @@ ReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
             break;
         }
         // remove duplicates
-        if (pk_set_.count(pk) == 0) {
-            pilot->search_result_->result_offsets_.push_back(offset++);
+        if (pk_set.count(pk) == 0) {
+            result_segments.push_back(index);
             final_search_records_[index][qi].push_back(pilot->offset_);
-            pk_set_.insert(pk);
+            pk_set.insert(pk);
         } else {
             // skip entity with same primary key
             dup_cnt++;
@@ -268,21 +275,54 @@ ReduceHelper::ReduceResultData() {
                    "incorrect search result primary key size");
     }
 
-    int64_t filtered_count = 0;
+    // queries are reduced independently, hand them out in batches so that
+    // every task reuses its scratch across a few queries
+    auto parallelism =
+        SegcoreConfig::default_config().get_reduce_parallelism();
+    auto nq_per_task = std::max<int64_t>(
+        MIN_REDUCE_NQ_PER_TASK, upper_div(total_nq_, parallelism * 4));
+    auto num_tasks = upper_div(total_nq_, nq_per_task);
+    std::atomic<int64_t> filtered_count{0};
+    futures::ParallelForEach(num_tasks, parallelism, [&](int64_t task_id) {
+        auto nq_begin = task_id * nq_per_task;
+        auto nq_end = std::min(total_nq_, nq_begin + nq_per_task);
+        auto slice_index =
+            std::upper_bound(slice_nqs_prefix_sum_.begin(),
+                             slice_nqs_prefix_sum_.end(),
+                             nq_begin) -
+            slice_nqs_prefix_sum_.begin() - 1;
+        NQReduceScratch scratch;
+        int64_t task_filtered_count = 0;
+        for (int64_t qi = nq_begin; qi < nq_end; qi++) {
+            while (qi >= slice_nqs_prefix_sum_[slice_index + 1]) {
+                slice_index++;
+            }
+            task_filtered_count += ReduceSearchResultForOneNQ(
+                qi, slice_topKs_[slice_index], scratch);
+        }
+        filtered_count += task_filtered_count;
+    });
+    AssignResultOffsets();
+    if (filtered_count > 0) {
+        LOG_DEBUG("skip duplicated search result, count = {}",
+                  filtered_count.load());
+    }
+}
+
+void
+ReduceHelper::AssignResultOffsets() {
+    // result offsets are positions inside a slice, in query order, so they
+    // are assigned serially once every query has been reduced
     for (int64_t slice_index = 0; slice_index < num_slices_; slice_index++) {
         auto nq_begin = slice_nqs_prefix_sum_[slice_index];
         auto nq_end = slice_nqs_prefix_sum_[slice_index + 1];
-
-        // reduce search results
         int64_t offset = 0;
         for (int64_t qi = nq_begin; qi < nq_end; qi++) {
-            filtered_count += ReduceSearchResultForOneNQ(
-                qi, slice_topKs_[slice_index], offset);
+            for (auto index : nq_result_segments_[qi]) {
+                search_results_[index]->result_offsets_.push_back(offset++);
+            }
         }
     }
-    if (filtered_count > 0) {
-        LOG_DEBUG("skip duplicated search result, count = {}", filtered_count);
-    }
 }
 
 void
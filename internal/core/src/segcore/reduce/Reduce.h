@@ -32,6 +32,13 @@ struct SearchResultDataBlobs {
     std::vector<std::vector<char>> blobs;
 };
 
+// Per-task state for reducing a batch of queries, reused from one query to
+// the next so a task allocates it only once.
+struct NQReduceScratch {
+    std::vector<SearchResultPair> pairs;
+    std::unordered_set<milvus::PkType> pk_set;
+};
+
 class ReduceHelper {
  public:
     explicit ReduceHelper(std::vector<SearchResult*>& search_results,
@@ -77,10 +84,13 @@ class ReduceHelper {
     void
     ReduceResultData();
 
+    // Picks the results of query `qi` into final_search_records_ and
+    // nq_result_segments_[qi], returns the number of results filtered out.
+    // Called concurrently for different queries.
     virtual int64_t
     ReduceSearchResultForOneNQ(int64_t qi,
                                int64_t topk,
-                               int64_t& result_offset);
+                               NQReduceScratch& scratch);
 
     virtual void
     FillOtherData(int result_count,
@@ -96,6 +106,9 @@ class ReduceHelper {
     void
     FillEntryData();
 
+    void
+    AssignResultOffsets();
+
     std::vector<char>
     GetSearchResultDataSlice(int slice_index_);
 
@@ -106,12 +119,10 @@ class ReduceHelper {
     std::vector<int64_t> slice_nqs_prefix_sum_;
     int64_t num_segments_;
     std::vector<int64_t> slice_topKs_;
-    // Used for merge results,
-    // define these here to avoid allocating them for each query
-    std::vector<SearchResultPair> pairs_;
-    std::unordered_set<milvus::PkType> pk_set_;
     // dim0: num_segments_; dim1: total_nq_; dim2: offset
     std::vector<std::vector<std::vector<int64_t>>> final_search_records_;
+    // dim0: total_nq_; dim1: segment index of each kept result, in output order
+    std::vector<std::vector<int64_t>> nq_result_segments_;
     std::vector<int64_t> slice_nqs_;
     int64_t total_nq_;
     // output
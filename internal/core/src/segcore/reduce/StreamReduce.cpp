@@ -10,6 +10,11 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include "StreamReduce.h"
+
+#include <atomic>
+
+#include "futures/Executor.h"
+#include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/Utils.h"
 #include "segcore/reduce/Reduce.h"
@@ -183,10 +188,11 @@ StreamReducerHelper::SerializeMergedResult() {
                "Wrong state for num_slice in streamReducer, num_slice:{}",
                num_slice_);
     search_result_blobs->blobs.resize(num_slice_);
-    for (int i = 0; i < num_slice_; i++) {
-        auto proto = GetSearchResultDataSlice(i);
-        search_result_blobs->blobs[i] = proto;
-    }
+    auto parallelism =
+        SegcoreConfig::default_config().get_reduce_parallelism();
+    futures::ParallelForEach(num_slice_, parallelism, [&](int64_t i) {
+        search_result_blobs->blobs[i] = GetSearchResultDataSlice(i);
+    });
     return search_result_blobs.release();
 }
 
@@ -205,15 +211,46 @@ StreamReducerHelper::ReduceResultData() {
             AssertInfo(search_result->primary_keys_.size() == result_count,
                        "incorrect search result primary key size");
         }
-        for (int64_t slice_index = 0; slice_index < slice_nqs_.size();
-             slice_index++) {
-            auto nq_begin = slice_nqs_prefix_sum_[slice_index];
-            auto nq_end = slice_nqs_prefix_sum_[slice_index + 1];
-
-            int64_t offset = 0;
+        auto parallelism =
+            SegcoreConfig::default_config().get_reduce_parallelism();
+        auto nq_per_task = std::max<int64_t>(
+            MIN_REDUCE_NQ_PER_TASK, upper_div(total_nq_, parallelism * 4));
+        auto num_tasks = upper_div(total_nq_, nq_per_task);
+        futures::ParallelForEach(num_tasks, parallelism, [&](int64_t task_id) {
+            auto nq_begin = task_id * nq_per_task;
+            auto nq_end = std::min(total_nq_, nq_begin + nq_per_task);
+            auto slice_index =
+                std::upper_bound(slice_nqs_prefix_sum_.begin(),
+                                 slice_nqs_prefix_sum_.end(),
+                                 nq_begin) -
+                slice_nqs_prefix_sum_.begin() - 1;
+            StreamNQReduceScratch scratch;
             for (int64_t qi = nq_begin; qi < nq_end; qi++) {
+                while (qi >= slice_nqs_prefix_sum_[slice_index + 1]) {
+                    slice_index++;
+                }
                 StreamReduceSearchResultForOneNQ(
-                    qi, slice_topKs_[slice_index], offset);
+                    qi, slice_topKs_[slice_index], scratch);
+            }
+        });
+        AssignResultOffsets();
+    }
+}
+
+void
+StreamReducerHelper::AssignResultOffsets() {
+    for (int64_t slice_index = 0; slice_index < num_slice_; slice_index++) {
+        auto nq_begin = slice_nqs_prefix_sum_[slice_index];
+        auto nq_end = slice_nqs_prefix_sum_[slice_index + 1];
+        int64_t offset = 0;
+        for (int64_t qi = nq_begin; qi < nq_end; qi++) {
+            for (auto seg_index : nq_result_segments_[qi]) {
+                if (seg_index < num_segments_) {
+                    search_results_to_merge_[seg_index]
+                        ->result_offsets_.push_back(offset++);
+                } else {
+                    merged_search_result->reduced_offsets_.push_back(offset++);
+                }
             }
         }
     }
@@ -248,6 +285,7 @@ StreamReducerHelper::InitializeReduceRecords() {
     for (auto& search_record : final_search_records_) {
         search_record.resize(total_nq_);
     }
+    nq_result_segments_.resize(total_nq_);
 }
 
 void
@@ -318,15 +356,17 @@ StreamReducerHelper::FilterInvalidSearchResult(SearchResult* search_result) {
 }
 
 void
-StreamReducerHelper::StreamReduceSearchResultForOneNQ(int64_t qi,
-                                                      int64_t topK,
-                                                      int64_t& offset) {
+StreamReducerHelper::StreamReduceSearchResultForOneNQ(
+    int64_t qi, int64_t topK, StreamNQReduceScratch& scratch) {
+    auto& heap = scratch.heap;
+    auto& pk_set = scratch.pk_set;
+    auto& group_by_val_set = scratch.group_by_val_set;
     //1. clear heap for preceding left elements
-    while (!heap_.empty()) {
-        heap_.pop();
+    while (!heap.empty()) {
+        heap.pop();
     }
-    pk_set_.clear();
-    group_by_val_set_.clear();
+    pk_set.clear();
+    group_by_val_set.clear();
 
     //2. push new search results into sort-heap
     for (int i = 0; i < num_segments_; i++) {
@@ -361,9 +401,9 @@ StreamReducerHelper::StreamReduceSearchResultForOneNQ(int64_t qi,
                 ? std::make_optional(
                       search_result->group_by_values_.value().at(offset_beg))
                 : std::nullopt);
-        heap_.push(result_pair);
+        heap.push(result_pair);
     }
-    if (heap_.empty()) {
+    if (heap.empty()) {
         return;
     }
 
@@ -394,45 +434,41 @@ StreamReducerHelper::StreamReduceSearchResultForOneNQ(int64_t qi,
                           merged_search_result->group_by_values_.value().at(
                               merged_off_begin))
                     : std::nullopt);
-            heap_.push(merged_result_pair);
+            heap.push(merged_result_pair);
         }
     }
 
     //3. pop heap to sort
     int count = 0;
-    while (count < topK && !heap_.empty()) {
-        auto pilot = heap_.top();
-        heap_.pop();
+    while (count < topK && !heap.empty()) {
+        auto pilot = heap.top();
+        heap.pop();
         auto seg_index = pilot->segment_index_;
         auto pk = pilot->primary_key_;
         if (pk == INVALID_PK) {
             break;  // valid search result for this nq has been run out, break to next
         }
-        if (pk_set_.count(pk) == 0) {
+        if (pk_set.count(pk) == 0) {
             bool skip_for_group_by = false;
             if (pilot->group_by_value_.has_value()) {
-                if (group_by_val_set_.count(pilot->group_by_value_.value()) >
+                if (group_by_val_set.count(pilot->group_by_value_.value()) >
                     0) {
                     skip_for_group_by = true;
                 }
             }
             if (!skip_for_group_by) {
                 final_search_records_[seg_index][qi].push_back(pilot->offset_);
-                if (pilot->search_result_ != nullptr) {
-                    pilot->search_result_->result_offsets_.push_back(offset++);
-                } else {
-                    merged_search_result->reduced_offsets_.push_back(offset++);
-                }
-                pk_set_.insert(pk);
+                nq_result_segments_[qi].push_back(seg_index);
+                pk_set.insert(pk);
                 if (pilot->group_by_value_.has_value()) {
-                    group_by_val_set_.insert(pilot->group_by_value_.value());
+                    group_by_val_set.insert(pilot->group_by_value_.value());
                 }
                 count++;
             }
         }
         pilot->advance();
         if (pilot->primary_key_ != INVALID_PK) {
-            heap_.push(pilot);
+            heap.push(pilot);
         }
     }
 }
@@ -685,6 +721,7 @@ StreamReducerHelper::GetSearchResultDataSlice(int slice_index) {
 void
 StreamReducerHelper::CleanReduceStatus() {
     this->final_search_records_.clear();
+    this->nq_result_segments_.clear();
     this->merged_search_result->reduced_offsets_.clear();
 }
 }  // namespace milvus::segcore
\ No newline at end of file
@@ -132,6 +132,16 @@ struct StreamSearchResultPairComparator {
     }
 };
 
+// Per-task state for stream reducing a batch of queries.
+struct StreamNQReduceScratch {
+    std::priority_queue<std::shared_ptr<StreamSearchResultPair>,
+                        std::vector<std::shared_ptr<StreamSearchResultPair>>,
+                        StreamSearchResultPairComparator>
+        heap;
+    std::unordered_set<milvus::PkType> pk_set;
+    std::unordered_set<milvus::GroupByValueType> group_by_val_set;
+};
+
 class StreamReducerHelper {
  public:
     explicit StreamReducerHelper(milvus::query::Plan* plan,
@@ -188,7 +198,12 @@ class StreamReducerHelper {
     RefreshSearchResult();
 
     void
-    StreamReduceSearchResultForOneNQ(int64_t qi, int64_t topK, int64_t& offset);
+    StreamReduceSearchResultForOneNQ(int64_t qi,
+                                     int64_t topK,
+                                     StreamNQReduceScratch& scratch);
+
+    void
+    AssignResultOffsets();
 
     void
     FillEntryData();
@@ -210,13 +225,10 @@ class StreamReducerHelper {
     int64_t num_segments_{0};
     int64_t num_slice_{0};
     std::vector<int64_t> slice_nqs_prefix_sum_;
-    std::priority_queue<std::shared_ptr<StreamSearchResultPair>,
-                        std::vector<std::shared_ptr<StreamSearchResultPair>>,
-                        StreamSearchResultPairComparator>
-        heap_;
-    std::unordered_set<milvus::PkType> pk_set_;
-    std::unordered_set<milvus::GroupByValueType> group_by_val_set_;
     std::vector<std::vector<std::vector<int64_t>>> final_search_records_;
+    // dim0: total_nq_; dim1: segment index of each kept result, in output
+    // order, num_segments_ stands for the merged search result
+    std::vector<std::vector<int64_t>> nq_result_segments_;
     int64_t total_nq_{0};
 };
 }  // namespace milvus::segcore
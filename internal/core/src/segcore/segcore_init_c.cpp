@@ -53,6 +53,34 @@ SegcoreSetNprobe(const int64_t value) {
     config.set_nprobe(value);
 }
 
+extern "C" void
+SegcoreSetGrowingSearchParallelism(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_growing_search_parallelism(value);
+}
+
+extern "C" void
+SegcoreSetReduceParallelism(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_reduce_parallelism(value);
+}
+
+extern "C" void
+SegcoreSetGroupByParallelism(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_group_by_parallelism(value);
+}
+
+extern "C" void
+SegcoreSetEnableVarcharPkHashIndex(const bool value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_enable_varchar_pk_hash_index(value);
+}
+
 extern "C" void
 SegcoreSetKnowhereBuildThreadPoolNum(const uint32_t num_threads) {
     milvus::config::KnowhereInitBuildThreadPool(num_threads);
@@ -30,6 +30,18 @@ SegcoreSetNlist(const int64_t);
 void
 SegcoreSetNprobe(const int64_t);
 
+void
+SegcoreSetGrowingSearchParallelism(const int64_t);
+
+void
+SegcoreSetReduceParallelism(const int64_t);
+
+void
+SegcoreSetGroupByParallelism(const int64_t);
+
+void
+SegcoreSetEnableVarcharPkHashIndex(const bool);
+
 // return value must be freed by the caller
 char*
 SegcoreSetSimdType(const char*);
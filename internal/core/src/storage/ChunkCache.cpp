@@ -17,51 +17,68 @@
 #include "ChunkCache.h"
 #include <future>
 #include <memory>
+#include <unordered_set>
 #include "common/Types.h"
+#include "monitor/prometheus_client.h"
 
 namespace milvus::storage {
+std::map<std::string, CacheEvictionPolicy> CacheEvictionPolicy_Map = {
+    {"lru", CacheEvictionPolicy::LRU},
+    {"clock", CacheEvictionPolicy::CLOCK}};
+
 std::shared_ptr<ColumnBase>
 ChunkCache::Read(const std::string& filepath,
                  const MmapChunkDescriptorPtr& descriptor,
                  const FieldMeta& field_meta,
                  bool mmap_enabled) {
+    auto shard_idx = ShardIndex(filepath);
+    auto& shard = *shards_[shard_idx];
     // use rlock to get future
     {
-        std::shared_lock lck(mutex_);
-        auto it = columns_.find(filepath);
-        if (it != columns_.end()) {
+        std::shared_lock lck(shard.mutex);
+        auto it = shard.columns.find(filepath);
+        if (it != shard.columns.end()) {
+            Touch(shard, *it->second);
+            auto future = it->second->future;
             lck.unlock();
-            auto result = it->second.second.get();
+            monitor::internal_chunk_cache_op_count_hit.Increment();
+            auto result = future.get();
             AssertInfo(result, "unexpected null column, file={}", filepath);
             return result;
         }
     }
 
     // lock for mutation
-    std::unique_lock lck(mutex_);
+    std::unique_lock lck(shard.mutex);
     // double check no-futurn
-    auto it = columns_.find(filepath);
-    if (it != columns_.end()) {
+    auto it = shard.columns.find(filepath);
+    if (it != shard.columns.end()) {
+        Touch(shard, *it->second);
+        auto future = it->second->future;
         lck.unlock();
-        auto result = it->second.second.get();
+        monitor::internal_chunk_cache_op_count_hit.Increment();
+        auto result = future.get();
         AssertInfo(result, "unexpected null column, file={}", filepath);
         return result;
     }
 
-    std::promise<std::shared_ptr<ColumnBase>> p;
-    std::shared_future<std::shared_ptr<ColumnBase>> f = p.get_future();
-    columns_.emplace(filepath, std::make_pair(std::move(p), f));
+    auto entry = std::make_unique<Entry>();
+    entry->future = entry->promise.get_future();
+    shard.columns.emplace(filepath, std::move(entry));
     lck.unlock();
+    monitor::internal_chunk_cache_op_count_miss.Increment();
 
     // release lock and perform download and decode
     // other thread request same path shall get the future.
     std::unique_ptr<DataCodec> field_data;
     std::shared_ptr<ColumnBase> column;
+    uint64_t charged_bytes = 0;
     bool allocate_success = false;
     ErrorCode err_code = Success;
     std::string err_msg = "";
     try {
         field_data = DownloadAndDecodeRemoteFile(cm_.get(), filepath);
+        charged_bytes = field_data->GetFieldData()->Size();
         column = Mmap(
             field_data->GetFieldData(), descriptor, field_meta, mmap_enabled);
         allocate_success = true;
@@ -70,41 +87,61 @@ ChunkCache::Read(const std::string& filepath,
         err_msg = fmt::format("failed to read for chunkCache, seg_core_err:{}",
                               e.what());
     }
-    std::unique_lock mmap_lck(mutex_);
-    it = columns_.find(filepath);
-    if (it != columns_.end()) {
-        // check pair exists then set value
-        it->second.first.set_value(column);
-        if (allocate_success) {
-            AssertInfo(column, "unexpected null column, file={}", filepath);
+    {
+        std::unique_lock mmap_lck(shard.mutex);
+        it = shard.columns.find(filepath);
+        if (it != shard.columns.end()) {
+            // check pair exists then set value
+            it->second->promise.set_value(column);
+            if (allocate_success) {
+                AssertInfo(
+                    column, "unexpected null column, file={}", filepath);
+            }
+        } else {
+            PanicInfo(UnexpectedError,
+                      "Wrong code, the thread to download for cache should "
+                      "get the target entry");
         }
-    } else {
-        PanicInfo(UnexpectedError,
-                  "Wrong code, the thread to download for cache should get the "
-                  "target entry");
-    }
-    if (err_code != Success) {
-        columns_.erase(filepath);
-        throw SegcoreError(err_code, err_msg);
+        if (err_code != Success) {
+            shard.columns.erase(filepath);
+            throw SegcoreError(err_code, err_msg);
+        }
+
+        auto& new_entry = *it->second;
+        new_entry.charged_bytes = charged_bytes;
+        new_entry.ready = true;
+        {
+            std::lock_guard policy_lck(shard.policy_mutex);
+            new_entry.lru_iter =
+                shard.lru_list.insert(shard.lru_list.begin(), filepath);
+        }
+        cached_bytes_ += charged_bytes;
     }
+
+    // the new column is held by `column`, so it won't be evicted here
+    EvictIfNeeded(shard_idx);
+    monitor::internal_chunk_cache_cached_bytes_all.Set(cached_bytes_.load());
     return column;
 }
 
 void
 ChunkCache::Remove(const std::string& filepath) {
-    std::unique_lock lck(mutex_);
-    columns_.erase(filepath);
+    auto& shard = *shards_[ShardIndex(filepath)];
+    std::unique_lock lck(shard.mutex);
+    EraseEntry(shard, filepath);
+    monitor::internal_chunk_cache_cached_bytes_all.Set(cached_bytes_.load());
 }
 
 void
 ChunkCache::Prefetch(const std::string& filepath) {
-    std::shared_lock lck(mutex_);
-    auto it = columns_.find(filepath);
-    if (it == columns_.end()) {
+    auto& shard = *shards_[ShardIndex(filepath)];
+    std::shared_lock lck(shard.mutex);
+    auto it = shard.columns.find(filepath);
+    if (it == shard.columns.end()) {
         return;
     }
 
-    auto column = it->second.second.get();
+    auto column = it->second->future.get();
     auto ok = madvise(
         reinterpret_cast<void*>(const_cast<char*>(column->MmappedData())),
         column->ByteSize(),
@@ -119,6 +156,148 @@ ChunkCache::Prefetch(const std::string& filepath) {
     }
 }
 
+bool
+ChunkCache::Pin(const std::string& filepath) {
+    auto& shard = *shards_[ShardIndex(filepath)];
+    std::shared_lock lck(shard.mutex);
+    auto it = shard.columns.find(filepath);
+    if (it == shard.columns.end()) {
+        return false;
+    }
+    it->second->pin_count++;
+    return true;
+}
+
+void
+ChunkCache::Unpin(const std::string& filepath) {
+    auto& shard = *shards_[ShardIndex(filepath)];
+    std::shared_lock lck(shard.mutex);
+    auto it = shard.columns.find(filepath);
+    if (it == shard.columns.end()) {
+        // the entry has been removed explicitly
+        return;
+    }
+    auto prev = it->second->pin_count--;
+    AssertInfo(prev > 0, "unpin an unpinned column, file={}", filepath);
+}
+
+void
+ChunkCache::Touch(Shard& shard, Entry& entry) {
+    if (!entry.ready) {
+        return;
+    }
+    if (eviction_policy_ == CacheEvictionPolicy::CLOCK) {
+        entry.referenced.store(true, std::memory_order_relaxed);
+        return;
+    }
+    std::lock_guard policy_lck(shard.policy_mutex);
+    shard.lru_list.splice(
+        shard.lru_list.begin(), shard.lru_list, entry.lru_iter);
+}
+
+bool
+ChunkCache::Evictable(const Entry& entry) const {
+    if (!entry.ready || entry.pin_count.load() > 0) {
+        return false;
+    }
+    // the shared state of the future holds one reference, any other
+    // reference means an in-flight reader is still using the column
+    return entry.future.get().use_count() <= 1;
+}
+
+void
+ChunkCache::EvictIfNeeded(size_t start) {
+    if (capacity_bytes_ == 0 || cached_bytes_.load() <= capacity_bytes_) {
+        return;
+    }
+
+    // evict from the shard of the new column first, then the others,
+    // only one shard lock is held at any time
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        auto cached = cached_bytes_.load();
+        if (cached <= capacity_bytes_) {
+            break;
+        }
+        auto& shard = *shards_[(start + i) % shards_.size()];
+        std::unique_lock lck(shard.mutex);
+        EvictFromShard(shard, cached - capacity_bytes_);
+    }
+
+    if (cached_bytes_.load() > capacity_bytes_) {
+        LOG_WARN(
+            "chunk cache exceeds the capacity since the columns are pinned, "
+            "cached: {}MB, capacity: {}MB",
+            cached_bytes_.load() / (1024 * 1024),
+            capacity_bytes_ / (1024 * 1024));
+    }
+}
+
+uint64_t
+ChunkCache::EvictFromShard(Shard& shard, uint64_t to_free) {
+    std::vector<std::string> victims;
+    uint64_t freed = 0;
+    {
+        std::lock_guard policy_lck(shard.policy_mutex);
+        auto& lru_list = shard.lru_list;
+        if (eviction_policy_ == CacheEvictionPolicy::LRU) {
+            for (auto iter = lru_list.rbegin();
+                 iter != lru_list.rend() && freed < to_free;
+                 ++iter) {
+                const auto& entry = *shard.columns.at(*iter);
+                if (Evictable(entry)) {
+                    victims.push_back(*iter);
+                    freed += entry.charged_bytes;
+                }
+            }
+        } else {
+            // every entry is visited at most twice: the first visit
+            // clears the reference bit, the second one evicts it
+            auto& hand = shard.clock_hand;
+            auto steps = lru_list.size() * 2;
+            std::unordered_set<std::string> selected;
+            for (size_t i = 0; i < steps && freed < to_free; ++i) {
+                if (hand == lru_list.end()) {
+                    hand = lru_list.begin();
+                }
+                auto& entry = *shard.columns.at(*hand);
+                if (entry.referenced.exchange(false)) {
+                    ++hand;
+                    continue;
+                }
+                if (Evictable(entry) && selected.insert(*hand).second) {
+                    victims.push_back(*hand);
+                    freed += entry.charged_bytes;
+                }
+                ++hand;
+            }
+        }
+    }
+
+    for (const auto& filepath : victims) {
+        EraseEntry(shard, filepath);
+        monitor::internal_chunk_cache_op_count_evict.Increment();
+    }
+    return freed;
+}
+
+void
+ChunkCache::EraseEntry(Shard& shard, const std::string& filepath) {
+    auto it = shard.columns.find(filepath);
+    if (it == shard.columns.end()) {
+        return;
+    }
+    auto& entry = *it->second;
+    if (entry.ready) {
+        std::lock_guard policy_lck(shard.policy_mutex);
+        if (shard.clock_hand == entry.lru_iter) {
+            ++shard.clock_hand;
+        }
+        shard.lru_list.erase(entry.lru_iter);
+        cached_bytes_ -= entry.charged_bytes;
+    }
+    shard.columns.erase(it);
+}
+
 std::shared_ptr<ColumnBase>
 ChunkCache::Mmap(const FieldDataPtr& field_data,
                  const MmapChunkDescriptorPtr& descriptor,
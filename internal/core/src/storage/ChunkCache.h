@@ -15,7 +15,9 @@
 // limitations under the License.
 
 #pragma once
+#include <atomic>
 #include <future>
+#include <list>
 #include <unordered_map>
 #include "storage/MmapChunkManager.h"
 #include "mmap/Column.h"
@@ -24,12 +26,36 @@ namespace milvus::storage {
 
 extern std::map<std::string, int> ReadAheadPolicy_Map;
 
+enum class CacheEvictionPolicy {
+    LRU = 0,
+    CLOCK = 1,
+};
+
+extern std::map<std::string, CacheEvictionPolicy> CacheEvictionPolicy_Map;
+
+/**
+ * @brief ChunkCache caches the columns decoded from remote binlogs.
+ * The cache is bounded by `capacity_bytes` (0 means unlimited), once the
+ * budget is exceeded, unpinned columns are evicted according to the
+ * eviction policy (`lru` or `clock`).
+ * A column is considered pinned if it's pinned explicitly by Pin(), or
+ * any reader still holds the shared_ptr returned by Read(), evicting
+ * such column would not release any memory.
+ * Columns are sharded by the hash of file path, each shard has its own
+ * lock, single-flight futures and eviction state, the capacity is shared
+ * by all shards.
+ */
 class ChunkCache {
  public:
+    static constexpr size_t kDefaultShardNum = 32;
+
     explicit ChunkCache(const std::string& read_ahead_policy,
                         ChunkManagerPtr cm,
-                        MmapChunkManagerPtr mcm)
-        : cm_(cm), mcm_(mcm) {
+                        MmapChunkManagerPtr mcm,
+                        uint64_t capacity_bytes = 0,
+                        const std::string& eviction_policy = "lru",
+                        size_t shard_num = kDefaultShardNum)
+        : cm_(cm), mcm_(mcm), capacity_bytes_(capacity_bytes) {
         auto iter = ReadAheadPolicy_Map.find(read_ahead_policy);
         AssertInfo(iter != ReadAheadPolicy_Map.end(),
                    "unrecognized read ahead policy: {}, "
@@ -37,8 +63,24 @@ class ChunkCache {
                    "willneed, dontneed`",
                    read_ahead_policy);
         read_ahead_policy_ = iter->second;
-        LOG_INFO("Init ChunkCache with read_ahead_policy: {}",
-                 read_ahead_policy);
+        auto policy_iter = CacheEvictionPolicy_Map.find(eviction_policy);
+        AssertInfo(policy_iter != CacheEvictionPolicy_Map.end(),
+                   "unrecognized eviction policy: {}, "
+                   "should be one of `lru, clock`",
+                   eviction_policy);
+        eviction_policy_ = policy_iter->second;
+        AssertInfo(shard_num > 0, "shard num of chunk cache must be positive");
+        shards_.reserve(shard_num);
+        for (size_t i = 0; i < shard_num; ++i) {
+            shards_.emplace_back(std::make_unique<Shard>());
+        }
+        LOG_INFO(
+            "Init ChunkCache with read_ahead_policy: {}, capacity: {}MB, "
+            "eviction_policy: {}, shard_num: {}",
+            read_ahead_policy,
+            capacity_bytes_ / (1024 * 1024),
+            eviction_policy,
+            shard_num);
     }
 
     ~ChunkCache() = default;
@@ -56,6 +98,54 @@ class ChunkCache {
     void
     Prefetch(const std::string& filepath);
 
+    // Pin() keeps the cached column from being evicted until the same
+    // number of Unpin() are called, return false if the file is not cached.
+    bool
+    Pin(const std::string& filepath);
+
+    void
+    Unpin(const std::string& filepath);
+
+    uint64_t
+    GetCapacity() const {
+        return capacity_bytes_;
+    }
+
+    uint64_t
+    GetCachedBytes() const {
+        return cached_bytes_.load();
+    }
+
+    size_t
+    GetShardNum() const {
+        return shards_.size();
+    }
+
+ private:
+    struct Entry {
+        std::promise<std::shared_ptr<ColumnBase>> promise;
+        std::shared_future<std::shared_ptr<ColumnBase>> future;
+        // set once the column is ready, 0 for the loading entry
+        uint64_t charged_bytes = 0;
+        bool ready = false;
+        std::atomic<int64_t> pin_count = 0;
+        // CLOCK reference bit
+        std::atomic<bool> referenced = false;
+        // position in lru_list, front is the most recently used
+        std::list<std::string>::iterator lru_iter;
+    };
+
+    using ColumnTable = std::unordered_map<std::string, std::unique_ptr<Entry>>;
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        ColumnTable columns;
+        // guards lru_list and clock_hand, lock order: mutex -> policy_mutex
+        std::mutex policy_mutex;
+        std::list<std::string> lru_list;
+        std::list<std::string>::iterator clock_hand = lru_list.end();
+    };
+
  private:
     std::shared_ptr<ColumnBase>
     Mmap(const FieldDataPtr& field_data,
@@ -63,18 +153,41 @@ class ChunkCache {
          const FieldMeta& field_meta,
          bool mmap_enabled);
 
- private:
-    using ColumnTable = std::unordered_map<
-        std::string,
-        std::pair<std::promise<std::shared_ptr<ColumnBase>>,
-                  std::shared_future<std::shared_ptr<ColumnBase>>>>;
+    size_t
+    ShardIndex(const std::string& filepath) const {
+        return std::hash<std::string>{}(filepath) % shards_.size();
+    }
+
+    // mark the entry as recently used, caller must hold shard.mutex
+    void
+    Touch(Shard& shard, Entry& entry);
+
+    // evict unpinned entries until the cache fits in the capacity,
+    // starting from the shard `start`, caller must not hold any shard lock
+    void
+    EvictIfNeeded(size_t start);
+
+    // evict at most `to_free` bytes from the shard, return the freed bytes,
+    // caller must hold the unique lock of shard.mutex
+    uint64_t
+    EvictFromShard(Shard& shard, uint64_t to_free);
+
+    bool
+    Evictable(const Entry& entry) const;
+
+    // caller must hold the unique lock of shard.mutex
+    void
+    EraseEntry(Shard& shard, const std::string& filepath);
 
  private:
-    mutable std::shared_mutex mutex_;
     int read_ahead_policy_;
     ChunkManagerPtr cm_;
     MmapChunkManagerPtr mcm_;
-    ColumnTable columns_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    uint64_t capacity_bytes_;
+    CacheEvictionPolicy eviction_policy_;
+    std::atomic<uint64_t> cached_bytes_ = 0;
 };
 
 using ChunkCachePtr = std::shared_ptr<milvus::storage::ChunkCache>;
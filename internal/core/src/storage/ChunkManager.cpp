@@ -14,6 +14,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
@@ -40,6 +42,80 @@
 
 namespace milvus::storage {
 
+void
+ChunkManager::ReadRanges(const std::string& filepath,
+                         const std::vector<ReadRange>& ranges,
+                         uint64_t merge_gap) {
+    // empty ranges need no request, a remote read of 0 bytes may fetch the
+    // whole object
+    std::vector<size_t> order;
+    order.reserve(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        if (ranges[i].len > 0) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return ranges[lhs].offset < ranges[rhs].offset;
+    });
+
+    std::vector<uint8_t> merged_buf;
+    size_t i = 0;
+    while (i < order.size()) {
+        // collect the ranges which could be fetched in one request
+        auto begin = ranges[order[i]].offset;
+        auto end = begin + ranges[order[i]].len;
+        size_t j = i + 1;
+        while (j < order.size() && ranges[order[j]].offset <= end + merge_gap) {
+            end = std::max(end, ranges[order[j]].offset + ranges[order[j]].len);
+            ++j;
+        }
+
+        if (j == i + 1) {
+            const auto& range = ranges[order[i]];
+            auto read_size = Read(filepath, range.offset, range.buf, range.len);
+            AssertInfo(read_size == range.len,
+                       "read size mismatch, file={}, offset={}, expected={}, "
+                       "actual={}",
+                       filepath,
+                       range.offset,
+                       range.len,
+                       read_size);
+        } else {
+            merged_buf.resize(end - begin);
+            auto read_size =
+                Read(filepath, begin, merged_buf.data(), merged_buf.size());
+            AssertInfo(read_size == merged_buf.size(),
+                       "read size mismatch, file={}, offset={}, expected={}, "
+                       "actual={}",
+                       filepath,
+                       begin,
+                       merged_buf.size(),
+                       read_size);
+            for (auto k = i; k < j; ++k) {
+                const auto& range = ranges[order[k]];
+                std::memcpy(range.buf,
+                            merged_buf.data() + (range.offset - begin),
+                            range.len);
+            }
+        }
+        i = j;
+    }
+}
+
+std::pair<std::shared_ptr<uint8_t[]>, uint64_t>
+ChunkManager::ReadAll(const std::string& filepath) {
+    auto size = Size(filepath);
+    auto buf = std::shared_ptr<uint8_t[]>(new uint8_t[size]);
+    auto read_size = Read(filepath, buf.get(), size);
+    AssertInfo(read_size == size,
+               "read size mismatch, file={}, expected={}, actual={}",
+               filepath,
+               size,
+               read_size);
+    return {buf, size};
+}
+
 Aws::String
 ConvertToAwsString(const std::string& str) {
     return Aws::String(str.c_str(), str.size());
@@ -19,11 +19,24 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace milvus::storage {
 
+// ranges whose gap is not larger than this are merged into one request
+constexpr uint64_t DEFAULT_READ_RANGES_MERGE_GAP = 64 * 1024;
+
+/**
+ * @brief A byte range of a file, [offset, offset + len) is read into buf
+ */
+struct ReadRange {
+    uint64_t offset;
+    uint64_t len;
+    void* buf;
+};
+
 /**
  * @brief This ChunkManager is abstract interface for milvus that
  * used to manager operation and interaction with storage
@@ -91,6 +104,27 @@ class ChunkManager {
           void* buf,
           uint64_t len) = 0;
 
+    /**
+     * @brief Read multiple ranges of file, ranges that are adjacent or
+     * separated by at most merge_gap bytes are fetched in one request
+     * @param filepath
+     * @param ranges
+     * @param merge_gap
+     */
+    virtual void
+    ReadRanges(const std::string& filepath,
+               const std::vector<ReadRange>& ranges,
+               uint64_t merge_gap = DEFAULT_READ_RANGES_MERGE_GAP);
+
+    /**
+     * @brief Read the whole file into a new buffer, remote chunk managers
+     * should learn the size from the response and fetch it in one request
+     * @param filepath
+     * @return buffer and its size
+     */
+    virtual std::pair<std::shared_ptr<uint8_t[]>, uint64_t>
+    ReadAll(const std::string& filepath);
+
     /**
      * @brief List files with same prefix
      * @param filepath
@@ -125,4 +125,39 @@ DeserializeFileData(const std::shared_ptr<uint8_t[]> input_data,
     return res;
 }
 
+int64_t
+DeserializeFileDataInto(const std::shared_ptr<uint8_t[]> input_data,
+                        int64_t length,
+                        const PayloadDecodeTarget& target) {
+    auto reader = std::make_shared<BinlogReader>(input_data, length);
+    AssertInfo(ReadMediumType(reader) == StorageType::Remote,
+               "only remote binlog can be decoded in place");
+    DescriptorEvent descriptor_event(reader);
+    DataType data_type =
+        DataType(descriptor_event.event_data.fix_part.data_type);
+    auto& extras = descriptor_event.event_data.extras;
+    bool nullable = (extras.find(NULLABLE) != extras.end())
+                        ? std::any_cast<bool>(extras[NULLABLE])
+                        : false;
+    EventHeader header(reader);
+    AssertInfo(header.event_type_ == EventType::InsertEvent,
+               "only insert event can be decoded in place, got {}",
+               header.event_type_);
+
+    Timestamp start_timestamp;
+    Timestamp end_timestamp;
+    auto ast = reader->Read(sizeof(start_timestamp), &start_timestamp);
+    AssertInfo(ast.ok(), "read start timestamp failed");
+    ast = reader->Read(sizeof(end_timestamp), &end_timestamp);
+    AssertInfo(ast.ok(), "read end timestamp failed");
+
+    int payload_length = header.event_length_ - GetEventHeaderSize(header) -
+                         sizeof(start_timestamp) - sizeof(end_timestamp);
+    auto res = reader->Read(payload_length);
+    AssertInfo(res.first.ok(), "read payload failed");
+    PayloadReader payload_reader(
+        res.second.get(), payload_length, data_type, nullable, target);
+    return payload_reader.get_num_rows();
+}
+
 }  // namespace milvus::storage
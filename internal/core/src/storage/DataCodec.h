@@ -22,6 +22,7 @@
 
 #include "common/FieldData.h"
 #include "storage/Types.h"
+#include "storage/PayloadReader.h"
 #include "storage/PayloadStream.h"
 #include "storage/BinlogReader.h"
 
@@ -85,4 +86,11 @@ DeserializeRemoteFileData(BinlogReaderPtr reader);
 std::unique_ptr<DataCodec>
 DeserializeLocalFileData(BinlogReaderPtr reader);
 
+// Deserialize a remote insert binlog of a fixed-width field straight into
+// target, return the number of rows decoded
+int64_t
+DeserializeFileDataInto(const std::shared_ptr<uint8_t[]> input,
+                        int64_t length,
+                        const PayloadDecodeTarget& target);
+
 }  // namespace milvus::storage
@@ -395,6 +395,19 @@ MinioChunkManager::Read(const std::string& filepath, void* buf, uint64_t size) {
     return GetObjectBuffer(default_bucket_name_, filepath, buf, size);
 }
 
+uint64_t
+MinioChunkManager::Read(const std::string& filepath,
+                        uint64_t offset,
+                        void* buf,
+                        uint64_t size) {
+    return GetObjectBuffer(default_bucket_name_, filepath, buf, size, offset);
+}
+
+std::pair<std::shared_ptr<uint8_t[]>, uint64_t>
+MinioChunkManager::ReadAll(const std::string& filepath) {
+    return GetObjectAll(default_bucket_name_, filepath);
+}
+
 void
 MinioChunkManager::Write(const std::string& filepath,
                          void* buf,
@@ -642,10 +655,18 @@ uint64_t
 MinioChunkManager::GetObjectBuffer(const std::string& bucket_name,
                                    const std::string& object_name,
                                    void* buf,
-                                   uint64_t size) {
+                                   uint64_t size,
+                                   uint64_t offset) {
+    // a request without range would fetch the whole object
+    if (size == 0) {
+        return 0;
+    }
     Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(bucket_name.c_str());
     request.SetKey(object_name.c_str());
+    // only fetch the requested bytes by http range get
+    request.SetRange(ConvertToAwsString(
+        fmt::format("bytes={}-{}", offset, offset + size - 1)));
 
     request.SetResponseStreamFactory([buf, size]() {
     // For macOs, pubsetbuf interface not implemented
@@ -665,19 +686,62 @@ MinioChunkManager::GetObjectBuffer(const std::string& bucket_name,
         std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now() - start)
             .count());
-    monitor::internal_storage_kv_size_get.Observe(size);
 
     if (!outcome.IsSuccess()) {
         monitor::internal_storage_op_count_get_fail.Increment();
         const auto& err = outcome.GetError();
         ThrowS3Error("GetObjectBuffer",
+                     err,
+                     "params, bucket={}, object={}, offset={}, size={}",
+                     bucket_name,
+                     object_name,
+                     offset,
+                     size);
+    }
+    // a range past the end of the object is cut short by the server
+    auto received = std::min<uint64_t>(
+        outcome.GetResult().GetContentLength(), size);
+    monitor::internal_storage_kv_size_get.Observe(received);
+    monitor::internal_storage_op_count_get_suc.Increment();
+    return received;
+}
+
+std::pair<std::shared_ptr<uint8_t[]>, uint64_t>
+MinioChunkManager::GetObjectAll(const std::string& bucket_name,
+                                const std::string& object_name) {
+    // the size comes with the response, no need to stat the object first
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(bucket_name.c_str());
+    request.SetKey(object_name.c_str());
+
+    auto start = std::chrono::system_clock::now();
+    auto outcome = client_->GetObject(request);
+    monitor::internal_storage_request_latency_get.Observe(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now() - start)
+            .count());
+
+    if (!outcome.IsSuccess()) {
+        monitor::internal_storage_op_count_get_fail.Increment();
+        const auto& err = outcome.GetError();
+        ThrowS3Error("GetObjectAll",
                      err,
                      "params, bucket={}, object={}",
                      bucket_name,
                      object_name);
     }
+    auto& result = outcome.GetResult();
+    uint64_t size = result.GetContentLength();
+    auto buf = std::shared_ptr<uint8_t[]>(new uint8_t[size]);
+    result.GetBody().read(reinterpret_cast<char*>(buf.get()), size);
+    AssertInfo(static_cast<uint64_t>(result.GetBody().gcount()) == size,
+               "read size mismatch, object={}, expected={}, actual={}",
+               object_name,
+               size,
+               result.GetBody().gcount());
+    monitor::internal_storage_kv_size_get.Observe(size);
     monitor::internal_storage_op_count_get_suc.Increment();
-    return size;
+    return {buf, size};
 }
 
 std::vector<std::string>
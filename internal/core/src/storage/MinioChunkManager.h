@@ -117,9 +117,7 @@ class MinioChunkManager : public ChunkManager {
     Read(const std::string& filepath,
          uint64_t offset,
          void* buf,
-         uint64_t len) {
-        PanicInfo(NotImplemented, GetName() + "Read with offset not implement");
-    }
+         uint64_t len);
 
     virtual void
     Write(const std::string& filepath,
@@ -133,6 +131,9 @@ class MinioChunkManager : public ChunkManager {
     virtual uint64_t
     Read(const std::string& filepath, void* buf, uint64_t len);
 
+    std::pair<std::shared_ptr<uint8_t[]>, uint64_t>
+    ReadAll(const std::string& filepath) override;
+
     virtual void
     Write(const std::string& filepath, void* buf, uint64_t len);
 
@@ -193,7 +194,11 @@ class MinioChunkManager : public ChunkManager {
     GetObjectBuffer(const std::string& bucket_name,
                     const std::string& object_name,
                     void* buf,
-                    uint64_t size);
+                    uint64_t size,
+                    uint64_t offset = 0);
+    std::pair<std::shared_ptr<uint8_t[]>, uint64_t>
+    GetObjectAll(const std::string& bucket_name,
+                 const std::string& object_name);
 
     std::vector<std::string>
     ListObjects(const std::string& bucket_name, const std::string& prefix = "");
@@ -14,6 +14,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 #include "arrow/io/api.h"
 #include "arrow/status.h"
 #include "common/EasyAssert.h"
@@ -34,8 +38,28 @@ PayloadReader::PayloadReader(const uint8_t* data,
     init(input);
 }
 
-void
-PayloadReader::init(std::shared_ptr<arrow::io::BufferReader> input) {
+PayloadReader::PayloadReader(const uint8_t* data,
+                             int length,
+                             DataType data_type,
+                             bool nullable,
+                             const PayloadDecodeTarget& target)
+    : column_type_(data_type), nullable_(nullable) {
+    auto input = std::make_shared<arrow::io::BufferReader>(data, length);
+    // the whole payload is in memory already, decode it as one window
+    init(input, target, std::numeric_limits<int64_t>::max());
+}
+
+PayloadReader::PayloadReader(std::shared_ptr<arrow::io::RandomAccessFile> input,
+                             DataType data_type,
+                             bool nullable,
+                             const PayloadDecodeTarget& target,
+                             int64_t window_bytes)
+    : column_type_(data_type), nullable_(nullable) {
+    init(std::move(input), target, window_bytes);
+}
+
+std::unique_ptr<parquet::arrow::FileReader>
+PayloadReader::open(std::shared_ptr<arrow::io::RandomAccessFile> input) {
     arrow::MemoryPool* pool = arrow::default_memory_pool();
 
     // Configure general Parquet reader settings
@@ -57,6 +81,12 @@ PayloadReader::init(std::shared_ptr<arrow::io::BufferReader> input) {
     std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
     st = reader_builder.Build(&arrow_reader);
     AssertInfo(st.ok(), "build file reader");
+    return arrow_reader;
+}
+
+void
+PayloadReader::init(std::shared_ptr<arrow::io::BufferReader> input) {
+    auto arrow_reader = open(input);
 
     int64_t column_index = 0;
     auto file_meta = arrow_reader->parquet_reader()->metadata();
@@ -70,7 +100,7 @@ PayloadReader::init(std::shared_ptr<arrow::io::BufferReader> input) {
     auto total_num_rows = file_meta->num_rows();
 
     std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
-    st = arrow_reader->GetRecordBatchReader(&rb_reader);
+    auto st = arrow_reader->GetRecordBatchReader(&rb_reader);
     AssertInfo(st.ok(), "get record batch reader");
 
     field_data_ =
@@ -83,7 +113,178 @@ PayloadReader::init(std::shared_ptr<arrow::io::BufferReader> input) {
         field_data_->FillFieldData(array);
     }
     AssertInfo(field_data_->IsFull(), "field data hasn't been filled done");
+    num_rows_ = total_num_rows;
     // LOG_INFO("Peak arrow memory pool size {}", pool)->max_memory();
 }
 
+void
+PayloadReader::init(std::shared_ptr<arrow::io::RandomAccessFile> input,
+                    const PayloadDecodeTarget& target,
+                    int64_t window_bytes) {
+    AssertInfo(!IsVariableDataType(column_type_),
+               "decoding in place is only supported for fixed-width data "
+               "type, got {}",
+               column_type_);
+    AssertInfo(!nullable_ || target.valid_data != nullptr,
+               "valid data is required to decode a nullable payload");
+    auto arrow_reader = open(input);
+
+    int64_t column_index = 0;
+    auto file_meta = arrow_reader->parquet_reader()->metadata();
+    dim_ = IsVectorDataType(column_type_)
+               ? GetDimensionFromFileMetaData(
+                     file_meta->schema()->Column(column_index), column_type_)
+               : 1;
+    auto total_num_rows = file_meta->num_rows();
+    AssertInfo(total_num_rows <= target.capacity,
+               "payload has {} rows, exceeds decode target capacity {}",
+               total_num_rows,
+               target.capacity);
+
+    auto num_row_groups = file_meta->num_row_groups();
+    int row_group = 0;
+    while (row_group < num_row_groups) {
+        // a window takes at least one row group, and the following ones as
+        // long as their column chunks fit in window_bytes
+        std::vector<int> row_groups;
+        std::vector<arrow::io::ReadRange> ranges;
+        int64_t window_size = 0;
+        for (; row_group < num_row_groups; ++row_group) {
+            auto chunk =
+                file_meta->RowGroup(row_group)->ColumnChunk(column_index);
+            auto chunk_offset = chunk->data_page_offset();
+            if (chunk->has_dictionary_page() &&
+                chunk->dictionary_page_offset() > 0) {
+                chunk_offset =
+                    std::min(chunk_offset, chunk->dictionary_page_offset());
+            }
+            auto chunk_size = chunk->total_compressed_size();
+            if (!row_groups.empty() &&
+                window_size + chunk_size > window_bytes) {
+                break;
+            }
+            row_groups.push_back(row_group);
+            ranges.push_back({chunk_offset, chunk_size});
+            window_size += chunk_size;
+        }
+        auto st = input->WillNeed(ranges);
+        AssertInfo(st.ok(), "prefetch column chunks: {}", st.ToString());
+
+        std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+        st = arrow_reader->GetRecordBatchReader(row_groups, &rb_reader);
+        AssertInfo(st.ok(), "get record batch reader");
+
+        // only one record batch of decoded values is alive at a time, rows
+        // go to the target as soon as a batch is decoded
+        for (arrow::Result<std::shared_ptr<arrow::RecordBatch>> maybe_batch :
+             *rb_reader) {
+            AssertInfo(maybe_batch.ok(), "get batch record success");
+            fill_target(maybe_batch.ValueOrDie()->column(column_index),
+                        target);
+        }
+    }
+    AssertInfo(num_rows_ == total_num_rows,
+               "decoded {} rows, but payload has {} rows",
+               num_rows_,
+               total_num_rows);
+}
+
+template <typename ArrayType>
+static const void*
+GetRawValues(const std::shared_ptr<arrow::Array>& array,
+             arrow::Type::type expected_type) {
+    AssertInfo(array->type()->id() == expected_type,
+               "inconsistent data type, expected {}, actual {}",
+               expected_type,
+               array->type()->id());
+    return std::static_pointer_cast<ArrayType>(array)->raw_values();
+}
+
+void
+PayloadReader::fill_target(const std::shared_ptr<arrow::Array>& array,
+                           const PayloadDecodeTarget& target) {
+    auto element_count = array->length();
+    if (element_count == 0) {
+        return;
+    }
+    AssertInfo(num_rows_ + element_count <= target.capacity,
+               "decode target overflow, capacity {}, required {}",
+               target.capacity,
+               num_rows_ + element_count);
+
+    auto row_size = GetDataTypeSize(column_type_, dim_);
+    AssertInfo(row_size == target.row_size,
+               "inconsistent row size of {}, payload {}, target {}",
+               column_type_,
+               row_size,
+               target.row_size);
+    auto dst = target.data + num_rows_ * row_size;
+
+    const void* values = nullptr;
+    switch (column_type_) {
+        case DataType::BOOL: {
+            AssertInfo(array->type()->id() == arrow::Type::type::BOOL,
+                       "inconsistent data type");
+            // arrow packs booleans into bits, so they can't be copied as is
+            auto bool_array =
+                std::static_pointer_cast<arrow::BooleanArray>(array);
+            auto out = reinterpret_cast<bool*>(dst);
+            for (int64_t i = 0; i < element_count; ++i) {
+                out[i] = bool_array->Value(i);
+            }
+            break;
+        }
+        case DataType::INT8:
+            values = GetRawValues<arrow::Int8Array>(array,
+                                                    arrow::Type::type::INT8);
+            break;
+        case DataType::INT16:
+            values = GetRawValues<arrow::Int16Array>(
+                array, arrow::Type::type::INT16);
+            break;
+        case DataType::INT32:
+            values = GetRawValues<arrow::Int32Array>(
+                array, arrow::Type::type::INT32);
+            break;
+        case DataType::INT64:
+            values = GetRawValues<arrow::Int64Array>(
+                array, arrow::Type::type::INT64);
+            break;
+        case DataType::FLOAT:
+            values = GetRawValues<arrow::FloatArray>(
+                array, arrow::Type::type::FLOAT);
+            break;
+        case DataType::DOUBLE:
+            values = GetRawValues<arrow::DoubleArray>(
+                array, arrow::Type::type::DOUBLE);
+            break;
+        case DataType::VECTOR_FLOAT:
+        case DataType::VECTOR_FLOAT16:
+        case DataType::VECTOR_BFLOAT16:
+        case DataType::VECTOR_BINARY:
+            values = GetRawValues<arrow::FixedSizeBinaryArray>(
+                array, arrow::Type::type::FIXED_SIZE_BINARY);
+            break;
+        default:
+            PanicInfo(DataTypeInvalid,
+                      "unsupported data type {} to decode in place",
+                      column_type_);
+    }
+    if (values != nullptr) {
+        std::memcpy(dst, values, element_count * row_size);
+    }
+
+    if (nullable_) {
+        auto valid = target.valid_data + num_rows_;
+        if (array->null_count() == 0) {
+            std::fill_n(valid, element_count, true);
+        } else {
+            for (int64_t i = 0; i < element_count; ++i) {
+                valid[i] = array->IsValid(i);
+            }
+        }
+    }
+    num_rows_ += element_count;
+}
+
 }  // namespace milvus::storage
@@ -24,6 +24,16 @@
 
 namespace milvus::storage {
 
+// Caller-owned memory a fixed-width payload is decoded into, rows are
+// written back to back at `data` and, for nullable fields, one validity
+// flag per row at `valid_data`.
+struct PayloadDecodeTarget {
+    char* data{nullptr};
+    bool* valid_data{nullptr};
+    size_t row_size{0};
+    int64_t capacity{0};
+};
+
 class PayloadReader {
  public:
     explicit PayloadReader(const uint8_t* data,
@@ -31,21 +41,56 @@ class PayloadReader {
                            DataType data_type,
                            bool nullable_);
 
+    // decode the payload straight into target without building a FieldData
+    PayloadReader(const uint8_t* data,
+                  int length,
+                  DataType data_type,
+                  bool nullable,
+                  const PayloadDecodeTarget& target);
+
+    // decode the payload read from input into target, row groups are decoded
+    // in windows of at most window_bytes of column chunks, and each window is
+    // announced to input by WillNeed before it's read
+    PayloadReader(std::shared_ptr<arrow::io::RandomAccessFile> input,
+                  DataType data_type,
+                  bool nullable,
+                  const PayloadDecodeTarget& target,
+                  int64_t window_bytes);
+
     ~PayloadReader() = default;
 
     void
     init(std::shared_ptr<arrow::io::BufferReader> buffer);
 
+    void
+    init(std::shared_ptr<arrow::io::RandomAccessFile> input,
+         const PayloadDecodeTarget& target,
+         int64_t window_bytes);
+
     const FieldDataPtr
     get_field_data() const {
         return field_data_;
     }
 
+    int64_t
+    get_num_rows() const {
+        return num_rows_;
+    }
+
+ private:
+    std::unique_ptr<parquet::arrow::FileReader>
+    open(std::shared_ptr<arrow::io::RandomAccessFile> input);
+
+    void
+    fill_target(const std::shared_ptr<arrow::Array>& array,
+                const PayloadDecodeTarget& target);
+
  private:
     DataType column_type_;
     int dim_;
     bool nullable_;
     FieldDataPtr field_data_;
+    int64_t num_rows_{0};
 };
 
 }  // namespace milvus::storage
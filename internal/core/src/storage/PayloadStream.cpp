@@ -14,6 +14,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cstring>
+
 #include "arrow/api.h"
 
 #include "storage/PayloadStream.h"
@@ -121,4 +124,139 @@ PayloadInputStream::GetSize() {
     return arrow::Result<int64_t>(size_);
 }
 
+RemoteInputStream::RemoteInputStream(ChunkManagerPtr cm,
+                                     const std::string& filepath,
+                                     int64_t offset,
+                                     int64_t size)
+    : cm_(std::move(cm)),
+      filepath_(filepath),
+      offset_(offset),
+      size_(size),
+      tell_(0),
+      closed_(false) {
+}
+
+RemoteInputStream::~RemoteInputStream() noexcept {
+}
+
+arrow::Status
+RemoteInputStream::Close() {
+    closed_ = true;
+    return arrow::Status::OK();
+}
+
+bool
+RemoteInputStream::closed() const {
+    return closed_;
+}
+
+arrow::Result<int64_t>
+RemoteInputStream::Tell() const {
+    return arrow::Result<int64_t>(tell_);
+}
+
+arrow::Status
+RemoteInputStream::Seek(int64_t position) {
+    if (position < 0 || position > size_)
+        return arrow::Status::IOError("invalid position");
+    tell_ = position;
+    return arrow::Status::OK();
+}
+
+std::shared_ptr<arrow::Buffer>
+RemoteInputStream::FindCached(int64_t position, int64_t nbytes) {
+    std::lock_guard<std::mutex> lck(cache_mutex_);
+    for (const auto& [cached_position, buf] : cached_) {
+        if (position >= cached_position &&
+            position + nbytes <= cached_position + buf->size()) {
+            return arrow::SliceBuffer(buf, position - cached_position, nbytes);
+        }
+    }
+    return nullptr;
+}
+
+arrow::Status
+RemoteInputStream::WillNeed(const std::vector<arrow::io::ReadRange>& ranges) {
+    std::vector<std::pair<int64_t, std::shared_ptr<arrow::Buffer>>> cached;
+    std::vector<ReadRange> read_ranges;
+    for (const auto& range : ranges) {
+        if (range.offset < 0 || range.offset >= size_ || range.length <= 0)
+            continue;
+        auto len = std::min(range.length, size_ - range.offset);
+        ARROW_ASSIGN_OR_RAISE(auto buf, arrow::AllocateBuffer(len));
+        read_ranges.push_back({static_cast<uint64_t>(offset_ + range.offset),
+                               static_cast<uint64_t>(len),
+                               buf->mutable_data()});
+        cached.emplace_back(range.offset, std::move(buf));
+    }
+    {
+        // the previous window is dropped before the next one is fetched
+        std::lock_guard<std::mutex> lck(cache_mutex_);
+        cached_.clear();
+    }
+    try {
+        cm_->ReadRanges(filepath_, read_ranges);
+    } catch (std::exception& e) {
+        return arrow::Status::IOError(e.what());
+    }
+    std::lock_guard<std::mutex> lck(cache_mutex_);
+    cached_ = std::move(cached);
+    return arrow::Status::OK();
+}
+
+arrow::Result<int64_t>
+RemoteInputStream::ReadAt(int64_t position, int64_t nbytes, void* out) {
+    if (position < 0 || position > size_)
+        return arrow::Status::IOError("invalid position");
+    nbytes = std::min(nbytes, size_ - position);
+    if (nbytes <= 0)
+        return arrow::Result<int64_t>(0);
+    if (auto cached = FindCached(position, nbytes)) {
+        std::memcpy(out, cached->data(), nbytes);
+        return arrow::Result<int64_t>(nbytes);
+    }
+    try {
+        auto read_size = cm_->Read(filepath_, offset_ + position, out, nbytes);
+        return arrow::Result<int64_t>(read_size);
+    } catch (std::exception& e) {
+        return arrow::Status::IOError(e.what());
+    }
+}
+
+arrow::Result<std::shared_ptr<arrow::Buffer>>
+RemoteInputStream::ReadAt(int64_t position, int64_t nbytes) {
+    if (position < 0 || position > size_)
+        return arrow::Status::IOError("invalid position");
+    nbytes = std::min(nbytes, size_ - position);
+    if (nbytes > 0) {
+        if (auto cached = FindCached(position, nbytes)) {
+            return cached;
+        }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buf, arrow::AllocateResizableBuffer(nbytes));
+    ARROW_ASSIGN_OR_RAISE(auto read_size,
+                          ReadAt(position, nbytes, buf->mutable_data()));
+    ARROW_RETURN_NOT_OK(buf->Resize(read_size));
+    return std::shared_ptr<arrow::Buffer>(std::move(buf));
+}
+
+arrow::Result<int64_t>
+RemoteInputStream::Read(int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(auto read_size, ReadAt(tell_, nbytes, out));
+    tell_ += read_size;
+    return arrow::Result<int64_t>(read_size);
+}
+
+arrow::Result<std::shared_ptr<arrow::Buffer>>
+RemoteInputStream::Read(int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buf, ReadAt(tell_, nbytes));
+    tell_ += buf->size();
+    return arrow::Result<std::shared_ptr<arrow::Buffer>>(std::move(buf));
+}
+
+arrow::Result<int64_t>
+RemoteInputStream::GetSize() {
+    return arrow::Result<int64_t>(size_);
+}
+
 }  // namespace milvus::storage
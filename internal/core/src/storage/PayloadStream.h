@@ -18,10 +18,13 @@
 
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <utility>
 
 #include <arrow/api.h>
 #include <arrow/io/api.h>
 
+#include "storage/ChunkManager.h"
 #include "storage/Types.h"
 
 namespace milvus::storage {
@@ -90,4 +93,56 @@ class PayloadInputStream : public arrow::io::RandomAccessFile {
     bool closed_;
 };
 
+// RemoteInputStream exposes [offset, offset + size) of a file in chunk manager
+// as a random access file, every read is served by a ranged read, so parquet
+// reader only fetches the footer and the column chunks it needs. Ranges given
+// to WillNeed are fetched by one ReadRanges and reads within them are served
+// from memory until the next WillNeed.
+class RemoteInputStream : public arrow::io::RandomAccessFile {
+ public:
+    RemoteInputStream(ChunkManagerPtr cm,
+                      const std::string& filepath,
+                      int64_t offset,
+                      int64_t size);
+    ~RemoteInputStream() noexcept;
+
+    arrow::Status
+    Close() override;
+    arrow::Result<int64_t>
+    Tell() const override;
+    bool
+    closed() const override;
+    arrow::Status
+    Seek(int64_t position) override;
+    arrow::Result<int64_t>
+    Read(int64_t nbytes, void* out) override;
+    arrow::Result<std::shared_ptr<arrow::Buffer>>
+    Read(int64_t nbytes) override;
+    arrow::Result<int64_t>
+    ReadAt(int64_t position, int64_t nbytes, void* out) override;
+    arrow::Result<std::shared_ptr<arrow::Buffer>>
+    ReadAt(int64_t position, int64_t nbytes) override;
+    arrow::Result<int64_t>
+    GetSize() override;
+    arrow::Status
+    WillNeed(const std::vector<arrow::io::ReadRange>& ranges) override;
+
+ private:
+    // the cached buffer covering [position, position + nbytes), if any
+    std::shared_ptr<arrow::Buffer>
+    FindCached(int64_t position, int64_t nbytes);
+
+ private:
+    ChunkManagerPtr cm_;
+    const std::string filepath_;
+    const int64_t offset_;
+    const int64_t size_;
+    int64_t tell_;
+    bool closed_;
+
+    std::mutex cache_mutex_;
+    // positions in the stream and the bytes fetched by the last WillNeed
+    std::vector<std::pair<int64_t, std::shared_ptr<arrow::Buffer>>> cached_;
+};
+
 }  // namespace milvus::storage
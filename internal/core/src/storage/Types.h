@@ -121,6 +121,8 @@ struct StorageConfig {
 
 struct MmapConfig {
     std::string cache_read_ahead_policy;
+    uint64_t cache_capacity = 0;
+    std::string cache_eviction_policy = "lru";
     std::string mmap_path;
     uint64_t disk_limit;
     uint64_t fix_file_size;
@@ -137,6 +139,8 @@ struct MmapConfig {
     ToString() const {
         std::stringstream ss;
         ss << "[cache_read_ahead_policy=" << cache_read_ahead_policy
+           << ", cache_capacity=" << cache_capacity / (1024 * 1024) << "MB"
+           << ", cache_eviction_policy=" << cache_eviction_policy
            << ", mmap_path=" << mmap_path
            << ", disk_limit=" << disk_limit / (1024 * 1024) << "MB"
            << ", fix_file_size=" << fix_file_size / (1024 * 1024) << "MB"
@@ -15,6 +15,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <deque>
 #include <memory>
 
 #include "arrow/array/builder_binary.h"
@@ -31,6 +32,7 @@
 #endif
 #include "storage/ChunkManager.h"
 #include "storage/DiskFileManagerImpl.h"
+#include "storage/Event.h"
 #include "storage/InsertData.h"
 #include "storage/LocalChunkManager.h"
 #include "storage/MemFileManagerImpl.h"
@@ -521,6 +523,75 @@ DownloadAndDecodeRemoteFile(ChunkManager* chunk_manager,
     return DeserializeFileData(buf, fileSize);
 }
 
+std::pair<int64_t, int64_t>
+GetRemoteBinlogPayloadRange(ChunkManager* chunk_manager,
+                            const std::string& file,
+                            DescriptorEvent* descriptor_event) {
+    EventHeader header;
+    auto header_size = GetEventHeaderSize(header);
+    auto read_header = [&](int64_t size) {
+        auto buf = std::shared_ptr<uint8_t[]>(new uint8_t[size]);
+        auto read_size = chunk_manager->Read(file, 0, buf.get(), size);
+        AssertInfo(read_size == size,
+                   "read binlog header failed, file={}, size={}",
+                   file,
+                   size);
+        auto reader = std::make_shared<BinlogReader>(buf, size);
+        AssertInfo(ReadMediumType(reader) == StorageType::Remote,
+                   "not a remote binlog file: {}",
+                   file);
+        return reader;
+    };
+
+    // magic number and the header of descriptor event
+    auto descriptor_header =
+        EventHeader(read_header(sizeof(MAGIC_NUM) + header_size));
+    AssertInfo(descriptor_header.event_type_ == EventType::DescriptorEvent,
+               "descriptor event not found in binlog file: {}",
+               file);
+
+    // the whole descriptor event, followed by the header of the first data
+    // event, whose payload comes after the start/end timestamp
+    int64_t event_offset = sizeof(MAGIC_NUM) + descriptor_header.event_length_;
+    auto reader = read_header(event_offset + header_size);
+    DescriptorEvent descriptor(reader);
+    auto event_header = EventHeader(reader);
+    BaseEventData event_data;
+    auto fix_part_size = GetFixPartSize(event_data);
+    int64_t payload_offset = event_offset + header_size + fix_part_size;
+    int64_t payload_size =
+        event_header.event_length_ - header_size - fix_part_size;
+    AssertInfo(payload_size > 0,
+               "invalid payload size {} in binlog file: {}",
+               payload_size,
+               file);
+    if (descriptor_event != nullptr) {
+        *descriptor_event = std::move(descriptor);
+    }
+    return {payload_offset, payload_size};
+}
+
+int64_t
+DownloadAndDecodeRemoteFileInto(ChunkManagerPtr chunk_manager,
+                                const std::string& file,
+                                const PayloadDecodeTarget& target,
+                                int64_t window_bytes) {
+    DescriptorEvent descriptor_event;
+    auto [offset, size] = GetRemoteBinlogPayloadRange(
+        chunk_manager.get(), file, &descriptor_event);
+    auto data_type = DataType(descriptor_event.event_data.fix_part.data_type);
+    auto& extras = descriptor_event.event_data.extras;
+    bool nullable = (extras.find(NULLABLE) != extras.end())
+                        ? std::any_cast<bool>(extras[NULLABLE])
+                        : false;
+
+    auto input =
+        std::make_shared<RemoteInputStream>(chunk_manager, file, offset, size);
+    PayloadReader payload_reader(
+        input, data_type, nullable, target, window_bytes);
+    return payload_reader.get_num_rows();
+}
+
 std::pair<std::string, size_t>
 EncodeAndUploadIndexSlice(ChunkManager* chunk_manager,
                           uint8_t* buf,
@@ -578,6 +649,95 @@ GetObjectData(ChunkManager* remote_chunk_manager,
     return futures;
 }
 
+std::string
+DownloadToFileStats::ToString() const {
+    auto to_ms = [](std::chrono::duration<double> d) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(d).count();
+    };
+    auto to_mbps = [this](std::chrono::duration<double> d) {
+        return d.count() > 0 ? bytes / d.count() / (1024 * 1024) : 0.0;
+    };
+    return fmt::format(
+        "[bytes={}, total={}ms({:.2f}MB/s), download_sum={}ms, "
+        "wait_download={}ms, write={}ms({:.2f}MB/s)]",
+        bytes,
+        to_ms(total_duration),
+        to_mbps(total_duration),
+        to_ms(download_duration),
+        to_ms(wait_download_duration),
+        to_ms(write_duration),
+        to_mbps(write_duration));
+}
+
+int64_t
+DownloadToFile(ChunkManager* remote_chunk_manager,
+               const std::vector<std::string>& remote_files,
+               File& file,
+               int64_t offset,
+               size_t parallel_degree,
+               DownloadToFileStats& stats) {
+    AssertInfo(parallel_degree > 0, "parallel degree must be positive");
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::HIGH);
+    auto start = std::chrono::system_clock::now();
+
+    // every download is timed by its own task, the writer only sees how
+    // long it waited for them
+    using TimedCodec =
+        std::pair<std::unique_ptr<DataCodec>, std::chrono::duration<double>>;
+    auto download = [remote_chunk_manager](const std::string& remote_file) {
+        auto start_download = std::chrono::system_clock::now();
+        auto codec =
+            DownloadAndDecodeRemoteFile(remote_chunk_manager, remote_file);
+        return TimedCodec(std::move(codec),
+                          std::chrono::system_clock::now() - start_download);
+    };
+
+    // the window of in-flight downloads, the front one is written next
+    std::deque<std::future<TimedCodec>> inflight;
+    size_t next = 0;
+    auto fill_window = [&]() {
+        while (next < remote_files.size() &&
+               inflight.size() < parallel_degree) {
+            inflight.emplace_back(pool.Submit(download, remote_files[next]));
+            ++next;
+        }
+    };
+
+    fill_window();
+    while (!inflight.empty()) {
+        auto start_wait = std::chrono::system_clock::now();
+        auto [codec, download_duration] = inflight.front().get();
+        inflight.pop_front();
+        stats.wait_download_duration +=
+            std::chrono::system_clock::now() - start_wait;
+        stats.download_duration += download_duration;
+        // keep the network busy while writing the current one
+        fill_window();
+
+        auto field_data = codec->GetFieldData();
+        auto data = static_cast<const uint8_t*>(field_data->Data());
+        auto size = static_cast<int64_t>(field_data->DataSize());
+        auto start_write = std::chrono::system_clock::now();
+        int64_t written = 0;
+        while (written < size) {
+            auto n = pwrite(file.Descriptor(),
+                            data + written,
+                            size - written,
+                            offset + written);
+            AssertInfo(n > 0,
+                       "failed to write data to disk {}: {}",
+                       file.Path(),
+                       strerror(errno));
+            written += n;
+        }
+        stats.write_duration += std::chrono::system_clock::now() - start_write;
+        offset += size;
+        stats.bytes += size;
+    }
+    stats.total_duration += std::chrono::system_clock::now() - start;
+    return offset;
+}
+
 std::map<std::string, int64_t>
 PutIndexData(ChunkManager* remote_chunk_manager,
              const std::vector<const uint8_t*>& data_slices,
@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
 #include <future>
 
 #include "common/FieldData.h"
+#include "common/File.h"
 #include "common/LoadInfo.h"
 #include "knowhere/comp/index_param.h"
 #include "parquet/schema.h"
@@ -34,6 +36,8 @@
 
 namespace milvus::storage {
 
+struct DescriptorEvent;
+
 StorageType
 ReadMediumType(BinlogReaderPtr reader);
 
@@ -91,6 +95,24 @@ std::unique_ptr<DataCodec>
 DownloadAndDecodeRemoteFile(ChunkManager* chunk_manager,
                             const std::string& file);
 
+// locate the parquet payload of the first event in a remote binlog by
+// ranged reads of the event headers, return {offset, size} of the payload.
+// The descriptor event is parsed into descriptor_event if it's given.
+std::pair<int64_t, int64_t>
+GetRemoteBinlogPayloadRange(ChunkManager* chunk_manager,
+                            const std::string& file,
+                            DescriptorEvent* descriptor_event = nullptr);
+
+// decode a remote insert binlog of a fixed-width field straight into target
+// without downloading the whole object: the headers and the parquet footer
+// are fetched by ranged reads, then the column chunks of at most window_bytes
+// at a time, adjacent chunks in one request. Return the number of rows.
+int64_t
+DownloadAndDecodeRemoteFileInto(ChunkManagerPtr chunk_manager,
+                                const std::string& file,
+                                const PayloadDecodeTarget& target,
+                                int64_t window_bytes);
+
 std::pair<std::string, size_t>
 EncodeAndUploadIndexSlice(ChunkManager* chunk_manager,
                           uint8_t* buf,
@@ -111,6 +133,33 @@ std::vector<std::future<std::unique_ptr<DataCodec>>>
 GetObjectData(ChunkManager* remote_chunk_manager,
               const std::vector<std::string>& remote_files);
 
+struct DownloadToFileStats {
+    int64_t bytes = 0;
+    // wall time of the whole pipeline
+    std::chrono::duration<double> total_duration{};
+    // sum of the download time of every file, downloads overlap with each
+    // other and with the writes, so it may exceed the wall time
+    std::chrono::duration<double> download_duration{};
+    // time the writer spent waiting for the downloads
+    std::chrono::duration<double> wait_download_duration{};
+    std::chrono::duration<double> write_duration{};
+
+    std::string
+    ToString() const;
+};
+
+// Download the remote files with at most `parallel_degree` files in flight,
+// and write their payloads into `file` in order starting from `offset` by
+// pwrite, while the following files are still being downloaded.
+// Return the file offset after the last written byte.
+int64_t
+DownloadToFile(ChunkManager* remote_chunk_manager,
+               const std::vector<std::string>& remote_files,
+               File& file,
+               int64_t offset,
+               size_t parallel_degree,
+               DownloadToFileStats& stats);
+
 std::map<std::string, int64_t>
 PutIndexData(ChunkManager* remote_chunk_manager,
              const std::vector<const uint8_t*>& data_slices,
@@ -247,9 +247,18 @@ AzureBlobChunkManager::GetObjectBuffer(const std::string& bucket_name,
                                        const std::string& object_name,
                                        void* buf,
                                        uint64_t size) {
+    return GetObjectBuffer(bucket_name, object_name, 0, buf, size);
+}
+
+uint64_t
+AzureBlobChunkManager::GetObjectBuffer(const std::string& bucket_name,
+                                       const std::string& object_name,
+                                       uint64_t offset,
+                                       void* buf,
+                                       uint64_t size) {
     Azure::Storage::Blobs::DownloadBlobOptions downloadOptions;
     downloadOptions.Range = Azure::Core::Http::HttpRange();
-    downloadOptions.Range.Value().Offset = 0;
+    downloadOptions.Range.Value().Offset = offset;
     downloadOptions.Range.Value().Length = size;
     Azure::Core::Context context;
     if (requestTimeoutMs_ > 0) {
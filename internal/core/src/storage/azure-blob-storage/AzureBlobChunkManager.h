@@ -74,6 +74,12 @@ class AzureBlobChunkManager {
                     const std::string& object_name,
                     void* buf,
                     uint64_t size);
+    uint64_t
+    GetObjectBuffer(const std::string& bucket_name,
+                    const std::string& object_name,
+                    uint64_t offset,
+                    void* buf,
+                    uint64_t size);
     std::vector<std::string>
     ListObjects(const std::string& bucket_name,
                 const std::string& prefix = nullptr);
@@ -117,6 +117,14 @@ AzureChunkManager::Read(const std::string& filepath, void* buf, uint64_t size) {
     return GetObjectBuffer(default_bucket_name_, filepath, buf, size);
 }
 
+uint64_t
+AzureChunkManager::Read(const std::string& filepath,
+                        uint64_t offset,
+                        void* buf,
+                        uint64_t size) {
+    return GetObjectBuffer(default_bucket_name_, filepath, buf, size, offset);
+}
+
 void
 AzureChunkManager::Write(const std::string& filepath,
                          void* buf,
@@ -267,24 +275,32 @@ uint64_t
 AzureChunkManager::GetObjectBuffer(const std::string& bucket_name,
                                    const std::string& object_name,
                                    void* buf,
-                                   uint64_t size) {
+                                   uint64_t size,
+                                   uint64_t offset) {
+    // a download without length would fetch the rest of the blob
+    if (size == 0) {
+        return 0;
+    }
     uint64_t res;
     try {
         auto start = std::chrono::system_clock::now();
-        res = client_->GetObjectBuffer(bucket_name, object_name, buf, size);
+        res = client_->GetObjectBuffer(
+            bucket_name, object_name, offset, buf, size);
         monitor::internal_storage_request_latency_get.Observe(
             std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::system_clock::now() - start)
                 .count());
         monitor::internal_storage_op_count_get_suc.Increment();
-        monitor::internal_storage_kv_size_get.Observe(size);
+        monitor::internal_storage_kv_size_get.Observe(res);
     } catch (std::exception& err) {
         monitor::internal_storage_op_count_get_fail.Increment();
         ThrowAzureError("GetObjectBuffer",
                         err,
-                        "params, bucket={}, object={}",
+                        "params, bucket={}, object={}, offset={}, size={}",
                         bucket_name,
-                        object_name);
+                        object_name,
+                        offset,
+                        size);
     }
     return res;
 }
@@ -69,9 +69,7 @@ class AzureChunkManager : public ChunkManager {
     Read(const std::string& filepath,
          uint64_t offset,
          void* buf,
-         uint64_t len) {
-        PanicInfo(NotImplemented, GetName() + "Read with offset not implement");
-    }
+         uint64_t len);
 
     virtual void
     Write(const std::string& filepath,
@@ -145,7 +143,8 @@ class AzureChunkManager : public ChunkManager {
     GetObjectBuffer(const std::string& bucket_name,
                     const std::string& object_name,
                     void* buf,
-                    uint64_t size);
+                    uint64_t size,
+                    uint64_t offset = 0);
     std::vector<std::string>
     ListObjects(const std::string& bucket_name,
                 const std::string& prefix = nullptr);
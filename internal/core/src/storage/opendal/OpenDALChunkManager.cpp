@@ -193,6 +193,60 @@ OpenDALChunkManager::Read(const std::string& filepath,
     return buf_index;
 }
 
+uint64_t
+OpenDALChunkManager::Read(const std::string& filepath,
+                          uint64_t offset,
+                          void* buf,
+                          uint64_t size) {
+    // the c binding of opendal provides no seek or ranged reader yet,
+    // so skip the leading bytes and stop as soon as the range is filled
+    auto ret = opendal_operator_reader(op_ptr_, filepath.c_str());
+    if (ret.error != nullptr) {
+        THROWOPENDALERROR(ret.error, "GetObjectBuffer");
+    }
+    auto reader = OpendalReader(ret.reader);
+    uint64_t buf_size = 16 * 1024;
+    std::vector<uint8_t> skip_buf(std::min(offset, buf_size));
+    uint64_t skipped = 0;
+    while (skipped < offset) {
+        auto read_ret =
+            opendal_reader_read(reader.Get(),
+                                skip_buf.data(),
+                                std::min(offset - skipped, buf_size));
+        if (read_ret.error != nullptr) {
+            THROWOPENDALERROR(read_ret.error, "GetObjectBuffer");
+        }
+        if (read_ret.size == 0) {
+            break;
+        }
+        skipped += read_ret.size;
+    }
+    uint64_t buf_index = 0;
+    while (skipped == offset && buf_index < size) {
+        auto read_ret =
+            opendal_reader_read(reader.Get(),
+                                reinterpret_cast<uint8_t*>(buf) + buf_index,
+                                std::min(size - buf_index, buf_size));
+        if (read_ret.error != nullptr) {
+            THROWOPENDALERROR(read_ret.error, "GetObjectBuffer");
+        }
+        if (read_ret.size == 0) {
+            break;
+        }
+        buf_index += read_ret.size;
+    }
+    if (buf_index != size) {
+        PanicInfo(
+            S3Error,
+            fmt::format("Read size mismatch, offset is {}, target size is {}, "
+                        "actual size is {}",
+                        offset,
+                        size,
+                        buf_index));
+    }
+    return buf_index;
+}
+
 void
 OpenDALChunkManager::Write(const std::string& filepath,
                            void* buf,
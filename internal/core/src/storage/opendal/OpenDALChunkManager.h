@@ -44,9 +44,7 @@ class OpenDALChunkManager : public ChunkManager {
     Read(const std::string& filepath,
          uint64_t offset,
          void* buf,
-         uint64_t len) override {
-        PanicInfo(NotImplemented, GetName() + "Read with offset not implement");
-    }
+         uint64_t len) override;
 
     void
     Write(const std::string& filepath,
@@ -91,6 +91,9 @@ InitMmapManager(CMmapConfig c_mmap_config) {
         milvus::storage::MmapConfig mmap_config;
         mmap_config.cache_read_ahead_policy =
             std::string(c_mmap_config.cache_read_ahead_policy);
+        mmap_config.cache_capacity = c_mmap_config.cache_capacity;
+        mmap_config.cache_eviction_policy =
+            std::string(c_mmap_config.cache_eviction_policy);
         mmap_config.mmap_path = std::string(c_mmap_config.mmap_path);
         mmap_config.disk_limit = c_mmap_config.disk_limit;
         mmap_config.fix_file_size = c_mmap_config.fix_file_size;
@@ -0,0 +1,76 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "common/Types.h"
+
+using namespace milvus;
+
+static constexpr int64_t N = 10 * 1024 * 1024;
+
+// one bit out of `sparsity` is left unset, the others are filtered out
+static BitsetType
+GenFilteredBitset(int64_t sparsity) {
+    BitsetType bitset(N);
+    bitset.set();
+    std::default_random_engine rng(42);
+    std::uniform_int_distribution<int64_t> dist(0, sparsity - 1);
+    for (int64_t i = 0; i < N; ++i) {
+        if (dist(rng) == 0) {
+            bitset[i] = false;
+        }
+    }
+    return bitset;
+}
+
+static void
+Bitset_FindUnset_BitByBit(benchmark::State& state) {
+    auto bitset = GenFilteredBitset(state.range(0));
+    const size_t limit = N;
+    std::vector<int64_t> offsets;
+    offsets.reserve(limit);
+    for (auto _ : state) {
+        offsets.clear();
+        for (int64_t i = 0; i < N && offsets.size() < limit; ++i) {
+            if (!bitset[i]) {
+                offsets.push_back(i);
+            }
+        }
+        benchmark::DoNotOptimize(offsets.data());
+    }
+    state.counters["hits"] = offsets.size();
+}
+
+BENCHMARK(Bitset_FindUnset_BitByBit)->Arg(1)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void
+Bitset_FindUnset_Word(benchmark::State& state) {
+    auto bitset = GenFilteredBitset(state.range(0));
+    const size_t limit = N;
+    std::vector<int64_t> offsets;
+    offsets.reserve(limit);
+    for (auto _ : state) {
+        offsets.clear();
+        auto next = bitset.find_first_unset();
+        while (next.has_value() && offsets.size() < limit) {
+            offsets.push_back(*next);
+            next = bitset.find_next_unset(*next);
+        }
+        benchmark::DoNotOptimize(offsets.data());
+    }
+    state.counters["hits"] = offsets.size();
+}
+
+BENCHMARK(Bitset_FindUnset_Word)->Arg(1)->Arg(16)->Arg(1024)->Arg(65536);
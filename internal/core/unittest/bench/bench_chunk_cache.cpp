@@ -0,0 +1,100 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "storage/ChunkCache.h"
+#include "storage/LocalChunkManagerSingleton.h"
+#include "test_utils/Constants.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+static int file_num = 256;
+static int rows_per_file = 128;
+static int dim = 16;
+
+const auto field_meta = FieldMeta(FieldName("fakevec"),
+                                  FieldId(100),
+                                  DataType::VECTOR_FLOAT,
+                                  dim,
+                                  knowhere::metric::L2,
+                                  false);
+
+// many small binlogs, all of them fit in the cache after the first round
+const auto file_names = [] {
+    storage::LocalChunkManagerSingleton::GetInstance().Init(TestLocalPath);
+    auto lcm =
+        storage::LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    auto dataset = DataGen(schema, rows_per_file);
+    auto data = dataset.get_col<float>(vec_fid);
+
+    auto field_data_meta = storage::FieldDataMeta{1, 2, 3, vec_fid.get()};
+    auto meta = field_meta;
+    std::vector<std::string> names;
+    for (int i = 0; i < file_num; ++i) {
+        auto name = fmt::format("bench_chunk_cache/insert_log/1/2/3/{}", i);
+        PutFieldData(lcm.get(),
+                     std::vector<void*>{data.data()},
+                     std::vector<int64_t>{rows_per_file},
+                     std::vector<std::string>{name},
+                     field_data_meta,
+                     meta);
+        names.push_back(name);
+    }
+    return names;
+}();
+
+// shard num 1 behaves like the cache guarded by a single global lock
+const auto chunk_caches = [] {
+    auto lcm =
+        storage::LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    auto mcm = std::make_shared<storage::MmapChunkManager>(
+        "/tmp/bench_chunk_cache/", uint64_t(1) << 30, uint64_t(4) << 20);
+    std::map<size_t, storage::ChunkCachePtr> caches;
+    for (size_t shard_num :
+         {size_t(1), storage::ChunkCache::kDefaultShardNum}) {
+        caches[shard_num] = std::make_shared<storage::ChunkCache>(
+            "willneed", lcm, mcm, 0, "lru", shard_num);
+    }
+    return caches;
+}();
+
+static void
+ChunkCache_Read(benchmark::State& state) {
+    auto& cc = chunk_caches.at(state.range(0));
+    auto descriptor = std::make_shared<storage::MmapChunkDescriptor>(
+        storage::MmapChunkDescriptor{0, SegmentType::Sealed});
+    size_t i = state.thread_index();
+    for (auto _ : state) {
+        auto column = cc->Read(
+            file_names[i % file_names.size()], descriptor, field_meta, false);
+        benchmark::DoNotOptimize(column);
+        i += 7;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(ChunkCache_Read)
+    ->Arg(1)
+    ->Arg(storage::ChunkCache::kDefaultShardNum)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
@@ -0,0 +1,80 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "segcore/SegmentSealedImpl.h"
+#include "storage/RemoteChunkManagerSingleton.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+static int scalar_field_num = 32;
+static int64_t row_count = 100000;
+
+// a wide scalar schema, every field is written as one binlog
+const auto schema = [] {
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    for (int i = 0; i < scalar_field_num; ++i) {
+        auto data_type = i % 2 == 0 ? DataType::INT64 : DataType::DOUBLE;
+        schema->AddDebugField(fmt::format("scalar_{}", i), data_type);
+    }
+    return schema;
+}();
+
+const auto load_info = [] {
+    auto storage_config = get_default_local_storage_config();
+    storage::RemoteChunkManagerSingleton::GetInstance().Init(storage_config);
+    auto cm = storage::CreateChunkManager(storage_config);
+    auto dataset = DataGen(schema, row_count);
+    return PrepareInsertBinlog(1,
+                               2,
+                               3,
+                               storage_config.root_path + "/bench_load_field",
+                               dataset,
+                               cm);
+}();
+
+// one LoadFieldData call per field, as the query node issues them
+static void
+LoadFieldData_PerField(benchmark::State& state) {
+    for (auto _ : state) {
+        auto segment = CreateSealedSegment(schema);
+        for (auto& [field_id, info] : load_info.field_infos) {
+            LoadFieldDataInfo field_info;
+            field_info.field_infos.emplace(field_id, info);
+            segment->LoadFieldData(field_info);
+        }
+        benchmark::DoNotOptimize(segment);
+    }
+    state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+// all fields of the segment in one call, loaded concurrently
+static void
+LoadFieldData_AllFields(benchmark::State& state) {
+    for (auto _ : state) {
+        auto segment = CreateSealedSegment(schema);
+        segment->LoadFieldData(load_info);
+        benchmark::DoNotOptimize(segment);
+    }
+    state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+BENCHMARK(LoadFieldData_PerField)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(LoadFieldData_AllFields)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
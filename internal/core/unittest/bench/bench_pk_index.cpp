@@ -0,0 +1,154 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <shared_mutex>
+#include <vector>
+
+#include "segcore/InsertRecord.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+// pks in the index before the lookups start
+static constexpr int64_t kLoadedPks = 64 * 1024;
+// pks a find_first asks for
+static constexpr int64_t kFindFirstLimit = 100;
+
+// the previous growing pk index, a sorted map behind one lock, kept here
+// as the baseline to compare contention against
+class LockedPkMap {
+ public:
+    void
+    insert(const PkType& pk, int64_t offset) {
+        std::unique_lock<std::shared_mutex> lck(mtx_);
+        map_[std::get<int64_t>(pk)].emplace_back(offset);
+    }
+
+    std::vector<int64_t>
+    find(const PkType& pk) const {
+        std::shared_lock<std::shared_mutex> lck(mtx_);
+        auto it = map_.find(std::get<int64_t>(pk));
+        return it != map_.end() ? it->second : std::vector<int64_t>();
+    }
+
+    std::pair<std::vector<int64_t>, bool>
+    find_first(int64_t limit, const BitsetType& bitset) const {
+        std::shared_lock<std::shared_mutex> lck(mtx_);
+        std::vector<int64_t> seg_offsets;
+        auto it = map_.begin();
+        for (; it != map_.end() && int64_t(seg_offsets.size()) < limit;
+             ++it) {
+            for (auto offset = it->second.rbegin();
+                 offset != it->second.rend();
+                 ++offset) {
+                if (*offset < int64_t(bitset.size()) && !bitset[*offset]) {
+                    seg_offsets.push_back(*offset);
+                    break;
+                }
+            }
+        }
+        return {seg_offsets, it != map_.end()};
+    }
+
+ private:
+    std::map<int64_t, std::vector<int64_t>> map_;
+    mutable std::shared_mutex mtx_;
+};
+
+// every thread keeps inserting pks of its own, so the threads only
+// contend on the index itself
+template <typename Map>
+static void
+PkIndex_Insert(benchmark::State& state) {
+    static std::unique_ptr<Map> map;
+    if (state.thread_index() == 0) {
+        map = std::make_unique<Map>();
+    }
+    int64_t next = state.thread_index() * (int64_t(1) << 40);
+    for (auto _ : state) {
+        map->insert(PkType(next), next);
+        ++next;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// every thread inserts new pks while looking up random ones, like an
+// upsert stream deleting the rows it replaces
+template <typename Map>
+static void
+PkIndex_InsertAndFind(benchmark::State& state) {
+    static std::unique_ptr<Map> map;
+    if (state.thread_index() == 0) {
+        map = std::make_unique<Map>();
+        for (int64_t i = 0; i < kLoadedPks; ++i) {
+            map->insert(PkType(i), i);
+        }
+    }
+    std::default_random_engine rng(state.thread_index());
+    std::uniform_int_distribution<int64_t> dist(0, kLoadedPks - 1);
+    int64_t next = (state.thread_index() + 1) * (int64_t(1) << 40);
+    for (auto _ : state) {
+        map->insert(PkType(next), next);
+        ++next;
+        benchmark::DoNotOptimize(map->find(PkType(dist(rng))));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// thread 0 keeps reading the first pks by find_first, like a query with a
+// limit on a growing segment, while the other threads insert new pks
+template <typename Map>
+static void
+PkIndex_FindFirstDuringInsert(benchmark::State& state) {
+    static std::unique_ptr<Map> map;
+    if (state.thread_index() == 0) {
+        map = std::make_unique<Map>();
+        for (int64_t i = 0; i < kLoadedPks; ++i) {
+            map->insert(PkType(i), i);
+        }
+    }
+    BitsetType bitset(kLoadedPks);
+    bitset.reset();
+    int64_t next = (state.thread_index() + 1) * (int64_t(1) << 40);
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            benchmark::DoNotOptimize(map->find_first(kFindFirstLimit, bitset));
+        } else {
+            map->insert(PkType(next), next);
+            ++next;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(PkIndex_Insert, LockedPkMap)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(PkIndex_Insert, OffsetConcurrentMap<int64_t>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(PkIndex_InsertAndFind, LockedPkMap)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(PkIndex_InsertAndFind, OffsetConcurrentMap<int64_t>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(PkIndex_FindFirstDuringInsert, LockedPkMap)
+    ->ThreadRange(2, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(PkIndex_FindFirstDuringInsert, OffsetConcurrentMap<int64_t>)
+    ->ThreadRange(2, 16)
+    ->UseRealTime();
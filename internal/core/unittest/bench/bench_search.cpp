@@ -101,6 +101,42 @@ BENCHMARK(Search_GrowingIndex)
     ->MinTime(5)
     ->ArgsProduct({{true, false}, {8, 16, 32}});
 
+static void
+Search_GrowingBruteForce(benchmark::State& state) {
+    static int64_t N = 1024 * 64;
+    const auto dataset_ = [] {
+        auto dataset_ = DataGen(schema, N);
+        return dataset_;
+    }();
+
+    auto& segconf = SegcoreConfig::default_config();
+    segconf.set_chunk_rows(4 * 1024);
+    segconf.set_enable_interim_segment_index(false);
+    segconf.set_growing_search_parallelism(state.range(0));
+
+    auto segment = CreateGrowingSegment(schema, empty_index_meta, -1, segconf);
+    segment->PreInsert(N);
+    segment->Insert(0,
+                    N,
+                    dataset_.row_ids_.data(),
+                    dataset_.timestamps_.data(),
+                    dataset_.raw_);
+
+    Timestamp ts = 10000000;
+
+    for (auto _ : state) {
+        auto qr = segment->Search(search_plan.get(), ph_group.get(), ts);
+    }
+}
+
+BENCHMARK(Search_GrowingBruteForce)
+    ->MinTime(5)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
+
 static void
 Search_Sealed(benchmark::State& state) {
     auto segment = CreateSealedSegment(schema);
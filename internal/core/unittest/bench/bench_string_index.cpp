@@ -0,0 +1,94 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <benchmark/benchmark.h>
+#include <marisa.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "index/StringIndexMarisa.h"
+
+using namespace milvus;
+
+static constexpr int64_t N = 1024 * 1024;
+
+static const std::vector<std::string>&
+GetStrings() {
+    static std::vector<std::string> strings = [] {
+        std::vector<std::string> res(N);
+        std::default_random_engine rng(42);
+        std::uniform_int_distribution<int> dist('a', 'z');
+        for (auto& str : res) {
+            str.resize(8);
+            for (auto& c : str) {
+                c = static_cast<char>(dist(rng));
+            }
+        }
+        return res;
+    }();
+    return strings;
+}
+
+// keys starting with the last `letters` letters of the alphabet pass `> bound`
+static std::string
+GetBound(int64_t letters) {
+    return std::string(1, static_cast<char>('z' - letters + 1));
+}
+
+// the previous implementation: enumerate the whole trie and compare keys
+static void
+StringIndex_RangeGreaterThan_TrieScan(benchmark::State& state) {
+    auto& strings = GetStrings();
+    marisa::Keyset keyset;
+    for (auto& str : strings) {
+        keyset.push_back(str.c_str());
+    }
+    marisa::Trie trie;
+    trie.build(keyset);
+
+    auto bound = GetBound(state.range(0));
+    std::vector<size_t> ids;
+    for (auto _ : state) {
+        ids.clear();
+        marisa::Agent agent;
+        agent.set_query("");
+        while (trie.predictive_search(agent)) {
+            auto key = std::string(agent.key().ptr(), agent.key().length());
+            if (key > bound) {
+                ids.push_back(agent.key().id());
+            }
+        }
+        benchmark::DoNotOptimize(ids.data());
+    }
+    state.counters["hits"] = ids.size();
+}
+
+BENCHMARK(StringIndex_RangeGreaterThan_TrieScan)->Arg(1)->Arg(4)->Arg(13);
+
+static void
+StringIndex_RangeGreaterThan_Sorted(benchmark::State& state) {
+    auto& strings = GetStrings();
+    auto index = index::CreateStringIndexMarisa();
+    index->Build(strings.size(), strings.data());
+
+    auto bound = GetBound(state.range(0));
+    size_t hits = 0;
+    for (auto _ : state) {
+        auto bitset = index->Range(bound, OpType::GreaterThan);
+        hits = bitset.count();
+        benchmark::DoNotOptimize(hits);
+    }
+    state.counters["hits"] = hits;
+}
+
+BENCHMARK(StringIndex_RangeGreaterThan_Sorted)->Arg(1)->Arg(4)->Arg(13);
@@ -0,0 +1,75 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "knowhere/comp/index_param.h"
+#include "query/SubSearchResult.h"
+
+using namespace milvus;
+using namespace milvus::query;
+
+static int64_t nq = 1000;
+static int64_t topk = 100;
+static int64_t chunk_num = 64;
+
+// one sorted topk result per chunk, like brute force returns for each chunk
+const auto chunk_results = [] {
+    std::default_random_engine e(42);
+    std::vector<SubSearchResult> results;
+    results.reserve(chunk_num);
+    for (int64_t c = 0; c < chunk_num; ++c) {
+        SubSearchResult result(nq, topk, knowhere::metric::L2, -1);
+        auto& distances = result.mutable_distances();
+        auto& seg_offsets = result.mutable_seg_offsets();
+        for (int64_t n = 0; n < nq; ++n) {
+            auto begin = distances.begin() + n * topk;
+            std::generate(begin, begin + topk, [&] { return e() % 1000000; });
+            std::sort(begin, begin + topk);
+        }
+        std::generate(
+            seg_offsets.begin(), seg_offsets.end(), [&] { return e(); });
+        results.emplace_back(std::move(result));
+    }
+    return results;
+}();
+
+static void
+SubSearchResult_MergePairwise(benchmark::State& state) {
+    for (auto _ : state) {
+        SubSearchResult final_qr(nq, topk, knowhere::metric::L2, -1);
+        for (auto& result : chunk_results) {
+            final_qr.merge(result);
+        }
+        benchmark::DoNotOptimize(final_qr.get_ids());
+    }
+    state.SetItemsProcessed(state.iterations() * nq * topk * chunk_num);
+}
+
+static void
+SubSearchResult_MergeKWay(benchmark::State& state) {
+    std::vector<const SubSearchResult*> results;
+    for (auto& result : chunk_results) {
+        results.push_back(&result);
+    }
+    for (auto _ : state) {
+        SubSearchResult final_qr(nq, topk, knowhere::metric::L2, -1);
+        final_qr.merge(results);
+        benchmark::DoNotOptimize(final_qr.get_ids());
+    }
+    state.SetItemsProcessed(state.iterations() * nq * topk * chunk_num);
+}
+
+BENCHMARK(SubSearchResult_MergePairwise)->Unit(benchmark::kMillisecond);
+BENCHMARK(SubSearchResult_MergeKWay)->Unit(benchmark::kMillisecond);
@@ -16,6 +16,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <optional>
 #include <random>
 #include <string>
@@ -419,6 +420,93 @@ TEST(FindElement, f) {
 //     TestFindImpl<avx2_u64_u8::bitset_type>();
 // }
 
+//
+template <typename BitsetT>
+void
+TestFindUnsetImpl(BitsetT& bitset, const size_t max_v) {
+    const size_t n = bitset.size();
+
+    std::default_random_engine rng(123);
+    std::uniform_int_distribution<int8_t> u(0, max_v);
+
+    std::vector<size_t> zero_pos;
+    for (size_t i = 0; i < n; i++) {
+        bool enabled = (u(rng) == 0);
+        if (enabled) {
+            zero_pos.push_back(i);
+            bitset[i] = false;
+        }
+    }
+
+    StopWatch sw;
+
+    auto bit_idx = bitset.find_first_unset();
+    if (!bit_idx.has_value()) {
+        ASSERT_EQ(zero_pos.size(), 0);
+        return;
+    }
+
+    for (size_t i = 0; i < zero_pos.size(); i++) {
+        ASSERT_TRUE(bit_idx.has_value()) << n << ", " << max_v;
+        ASSERT_EQ(bit_idx.value(), zero_pos[i]) << n << ", " << max_v;
+        bit_idx = bitset.find_next_unset(bit_idx.value());
+    }
+
+    ASSERT_FALSE(bit_idx.has_value())
+        << n << ", " << max_v << ", " << bit_idx.value();
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+}
+
+template <typename BitsetT>
+void
+TestFindUnsetImpl() {
+    for (const size_t n : typical_sizes) {
+        for (const size_t pr : {1, 100}) {
+            BitsetT bitset(n);
+            bitset.set();
+
+            if (print_log) {
+                printf("Testing bitset, n=%zd, pr=%zd\n", n, pr);
+            }
+
+            TestFindUnsetImpl(bitset, pr);
+
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                bitset.set();
+                auto view = bitset.view(offset);
+
+                if (print_log) {
+                    printf("Testing bitset view, n=%zd, offset=%zd, pr=%zd\n",
+                           n,
+                           offset,
+                           pr);
+                }
+
+                TestFindUnsetImpl(view, pr);
+            }
+        }
+    }
+}
+
+//
+TEST(FindUnsetRef, f) {
+    using impl_traits = RefImplTraits<uint64_t, uint8_t>;
+    TestFindUnsetImpl<typename impl_traits::bitset_type>();
+}
+
+//
+TEST(FindUnsetElement, f) {
+    using impl_traits = ElementImplTraits<uint64_t, uint8_t>;
+    TestFindUnsetImpl<typename impl_traits::bitset_type>();
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 
 //
@@ -808,6 +896,195 @@ INSTANTIATE_TYPED_TEST_SUITE_P(InplaceCompareValTest,
 
 //////////////////////////////////////////////////////////////////////////////////////////
 
+//
+template <typename BitsetT, CompareOpType Op>
+void
+TestInplaceOrCompareValImpl(BitsetT& bitset, const uint64_t value) {
+    const size_t n = bitset.size();
+
+    // values around the sign bit catch signed comparisons
+    const uint64_t pool[] = {0,
+                             1,
+                             2,
+                             uint64_t(1) << 63,
+                             (uint64_t(1) << 63) + 1,
+                             std::numeric_limits<uint64_t>::max()};
+    std::vector<uint64_t> t(n, 0);
+
+    std::default_random_engine rng(123);
+    std::uniform_int_distribution<size_t> tt(0, std::size(pool) - 1);
+    for (size_t i = 0; i < n; i++) {
+        t[i] = pool[tt(rng)];
+    }
+
+    FillRandom(bitset, rng);
+    std::vector<bool> before(n);
+    for (size_t i = 0; i < n; i++) {
+        before[i] = bitset[i];
+    }
+
+    StopWatch sw;
+    bitset.template inplace_or_compare_val<uint64_t, Op>(t.data(), n, value);
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        bool cmp = false;
+        if constexpr (Op == CompareOpType::EQ) {
+            cmp = t[i] == value;
+        } else if constexpr (Op == CompareOpType::GE) {
+            cmp = t[i] >= value;
+        } else if constexpr (Op == CompareOpType::GT) {
+            cmp = t[i] > value;
+        } else if constexpr (Op == CompareOpType::LE) {
+            cmp = t[i] <= value;
+        } else if constexpr (Op == CompareOpType::LT) {
+            cmp = t[i] < value;
+        } else if constexpr (Op == CompareOpType::NE) {
+            cmp = t[i] != value;
+        }
+        ASSERT_EQ(before[i] || cmp, bitset[i]) << i;
+    }
+}
+
+template <typename BitsetT>
+void
+TestInplaceOrCompareValAllOps(BitsetT& bitset) {
+    for (const uint64_t value : {uint64_t(2), (uint64_t(1) << 63) + 1}) {
+        TestInplaceOrCompareValImpl<BitsetT, CompareOpType::EQ>(bitset, value);
+        TestInplaceOrCompareValImpl<BitsetT, CompareOpType::GE>(bitset, value);
+        TestInplaceOrCompareValImpl<BitsetT, CompareOpType::GT>(bitset, value);
+        TestInplaceOrCompareValImpl<BitsetT, CompareOpType::LE>(bitset, value);
+        TestInplaceOrCompareValImpl<BitsetT, CompareOpType::LT>(bitset, value);
+        TestInplaceOrCompareValImpl<BitsetT, CompareOpType::NE>(bitset, value);
+    }
+}
+
+template <typename BitsetT>
+void
+TestInplaceOrCompareValImpl() {
+    for (const size_t n : typical_sizes) {
+        BitsetT bitset(n);
+
+        if (print_log) {
+            printf("Testing bitset, n=%zd\n", n);
+        }
+
+        TestInplaceOrCompareValAllOps(bitset);
+
+        for (const size_t offset : typical_offsets) {
+            if (offset >= n) {
+                continue;
+            }
+
+            auto view = bitset.view(offset);
+
+            if (print_log) {
+                printf("Testing bitset view, n=%zd, offset=%zd\n", n, offset);
+            }
+
+            TestInplaceOrCompareValAllOps(view);
+        }
+    }
+}
+
+//
+template <typename T>
+class InplaceOrCompareValSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(InplaceOrCompareValSuite);
+
+TYPED_TEST_P(InplaceOrCompareValSuite, BitWise) {
+    using impl_traits = RefImplTraits<std::tuple_element_t<0, TypeParam>,
+                                      std::tuple_element_t<1, TypeParam>>;
+    TestInplaceOrCompareValImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceOrCompareValSuite, ElementWise) {
+    using impl_traits = ElementImplTraits<std::tuple_element_t<0, TypeParam>,
+                                          std::tuple_element_t<1, TypeParam>>;
+    TestInplaceOrCompareValImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceOrCompareValSuite, Avx2) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx2()) {
+        using impl_traits =
+            VectorizedImplTraits<std::tuple_element_t<0, TypeParam>,
+                                 std::tuple_element_t<1, TypeParam>,
+                                 milvus::bitset::detail::x86::VectorizedAvx2>;
+        TestInplaceOrCompareValImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceOrCompareValSuite, Avx512) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx512()) {
+        using impl_traits =
+            VectorizedImplTraits<std::tuple_element_t<0, TypeParam>,
+                                 std::tuple_element_t<1, TypeParam>,
+                                 milvus::bitset::detail::x86::VectorizedAvx512>;
+        TestInplaceOrCompareValImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceOrCompareValSuite, Neon) {
+#if defined(__aarch64__)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<std::tuple_element_t<0, TypeParam>,
+                             std::tuple_element_t<1, TypeParam>,
+                             milvus::bitset::detail::arm::VectorizedNeon>;
+    TestInplaceOrCompareValImpl<typename impl_traits::bitset_type>();
+#endif
+}
+
+TYPED_TEST_P(InplaceOrCompareValSuite, Dynamic) {
+    using impl_traits =
+        VectorizedImplTraits<std::tuple_element_t<0, TypeParam>,
+                             std::tuple_element_t<1, TypeParam>,
+                             milvus::bitset::detail::VectorizedDynamic>;
+    TestInplaceOrCompareValImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceOrCompareValSuite, VecRef) {
+    using impl_traits =
+        VectorizedImplTraits<std::tuple_element_t<0, TypeParam>,
+                             std::tuple_element_t<1, TypeParam>,
+                             milvus::bitset::detail::VectorizedRef>;
+    TestInplaceOrCompareValImpl<typename impl_traits::bitset_type>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(InplaceOrCompareValSuite,
+                            BitWise,
+                            ElementWise,
+                            Avx2,
+                            Avx512,
+                            Neon,
+                            Dynamic,
+                            VecRef);
+
+using TtypesOrCompareVal =
+    ::testing::Types<std::tuple<uint8_t, uint8_t>,
+                     std::tuple<uint64_t, uint8_t>,
+                     std::tuple<uint8_t, uint64_t>>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(InplaceOrCompareValTest,
+                               InplaceOrCompareValSuite,
+                               TtypesOrCompareVal);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
 //
 template <typename BitsetT, typename T>
 void
@@ -31,6 +31,7 @@
 #include "pb/plan.pb.h"
 #include "query/ExprImpl.h"
 #include "segcore/Collection.h"
+#include "segcore/SegcoreConfig.h"
 #include "segcore/reduce/Reduce.h"
 #include "segcore/reduce_c.h"
 #include "segcore/segment_c.h"
@@ -2013,6 +2014,117 @@ TEST(CApiTest, ReduceSearchWithExprFilterAll) {
     testReduceSearchWithExpr(2, 1, 1, true);
 }
 
+TEST(CApiTest, ReduceParallelMatchesSerial) {
+    auto collection = NewCollection(get_default_schema_config());
+    auto schema = ((milvus::segcore::Collection*)collection)->get_schema();
+    int N = 2000;
+    int num_segments = 4;
+    std::vector<CSegmentInterface> segments;
+    for (int i = 0; i < num_segments; i++) {
+        CSegmentInterface segment;
+        auto status = NewSegment(collection, Growing, i, &segment, false);
+        ASSERT_EQ(status.error_code, Success);
+        // overlapping seeds leave duplicated pks for reduce to remove
+        auto dataset = DataGen(schema, N, 42 + i / 2);
+        int64_t offset;
+        PreInsert(segment, N, &offset);
+        auto insert_data = serialize(dataset.raw_);
+        auto ins_res = Insert(segment,
+                              offset,
+                              N,
+                              dataset.row_ids_.data(),
+                              dataset.timestamps_.data(),
+                              insert_data.data(),
+                              insert_data.size());
+        ASSERT_EQ(ins_res.error_code, Success);
+        segments.push_back(segment);
+    }
+
+    int num_queries = 100;
+    int topK = 10;
+    auto fmt = boost::format(R"(vector_anns: <
+                                            field_id: 100
+                                            query_info: <
+                                                topk: %1%
+                                                metric_type: "L2"
+                                                search_params: "{\"nprobe\": 10}"
+                                            >
+                                            placeholder_tag: "$0">
+                                            output_field_ids: 100)") %
+               topK;
+    auto serialized_expr_plan = fmt.str();
+    auto binary_plan =
+        translate_text_plan_to_binary_plan(serialized_expr_plan.data());
+    void* plan = nullptr;
+    auto status = CreateSearchPlanByExpr(
+        collection, binary_plan.data(), binary_plan.size(), &plan);
+    ASSERT_EQ(status.error_code, Success);
+    auto blob = generate_query_data(num_queries);
+    void* placeholderGroup = nullptr;
+    status = ParsePlaceholderGroup(
+        plan, blob.data(), blob.length(), &placeholderGroup);
+    ASSERT_EQ(status.error_code, Success);
+
+    auto slice_nqs = std::vector<int64_t>{30, 30, 40};
+    auto slice_topKs = std::vector<int64_t>{topK / 2, topK, topK};
+    auto search_and_reduce = [&](int64_t parallelism) {
+        milvus::segcore::SegcoreConfig::default_config()
+            .set_reduce_parallelism(parallelism);
+        std::vector<CSearchResult> results;
+        for (auto segment : segments) {
+            CSearchResult res;
+            auto status =
+                CSearch(segment, plan, placeholderGroup, 1L << 63, &res);
+            EXPECT_EQ(status.error_code, Success);
+            results.push_back(res);
+        }
+        CSearchResultDataBlobs cSearchResultData;
+        auto status = ReduceSearchResultsAndFillData({},
+                                                     &cSearchResultData,
+                                                     plan,
+                                                     results.data(),
+                                                     results.size(),
+                                                     slice_nqs.data(),
+                                                     slice_topKs.data(),
+                                                     slice_nqs.size());
+        EXPECT_EQ(status.error_code, Success);
+        CheckSearchResultDuplicate(results);
+        auto blobs =
+            reinterpret_cast<milvus::segcore::SearchResultDataBlobs*>(
+                cSearchResultData)
+                ->blobs;
+        DeleteSearchResultDataBlobs(cSearchResultData);
+        for (auto res : results) {
+            DeleteSearchResult(res);
+        }
+        return blobs;
+    };
+
+    auto serial_blobs = search_and_reduce(1);
+    auto parallel_blobs = search_and_reduce(4);
+    milvus::segcore::SegcoreConfig::default_config().set_reduce_parallelism(4);
+    ASSERT_EQ(serial_blobs.size(), slice_nqs.size());
+    ASSERT_EQ(parallel_blobs.size(), slice_nqs.size());
+    for (size_t i = 0; i < slice_nqs.size(); i++) {
+        milvus::proto::schema::SearchResultData serial_data;
+        milvus::proto::schema::SearchResultData parallel_data;
+        ASSERT_TRUE(serial_data.ParseFromArray(serial_blobs[i].data(),
+                                               serial_blobs[i].size()));
+        ASSERT_TRUE(parallel_data.ParseFromArray(parallel_blobs[i].data(),
+                                                 parallel_blobs[i].size()));
+        ASSERT_EQ(serial_data.num_queries(), slice_nqs[i]);
+        ASSERT_EQ(parallel_data.SerializeAsString(),
+                  serial_data.SerializeAsString());
+    }
+
+    DeleteSearchPlan(plan);
+    DeletePlaceholderGroup(placeholderGroup);
+    for (auto segment : segments) {
+        DeleteSegment(segment);
+    }
+    DeleteCollection(collection);
+}
+
 TEST(CApiTest, LoadIndexInfo) {
     // generator index
     constexpr auto TOPK = 10;
@@ -205,3 +205,85 @@ TEST_F(ChunkCacheTest, TestMultithreads) {
     cc->Remove(file_name);
     lcm->Remove(file_name);
 }
+
+TEST_F(ChunkCacheTest, EvictWithCapacity) {
+    auto N = 1000;
+    auto dim = 128;
+    auto metric_type = knowhere::metric::L2;
+
+    auto schema = std::make_shared<milvus::Schema>();
+    auto fake_id = schema->AddDebugField(
+        "fakevec", milvus::DataType::VECTOR_FLOAT, dim, metric_type);
+    auto i64_fid = schema->AddDebugField("counter", milvus::DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+
+    auto dataset = milvus::segcore::DataGen(schema, N);
+
+    auto field_data_meta =
+        milvus::storage::FieldDataMeta{1, 2, 3, fake_id.get()};
+    auto field_meta = milvus::FieldMeta(milvus::FieldName("facevec"),
+                                        fake_id,
+                                        milvus::DataType::VECTOR_FLOAT,
+                                        dim,
+                                        metric_type,
+                                        false);
+
+    auto lcm = milvus::storage::LocalChunkManagerSingleton::GetInstance()
+                   .GetChunkManager();
+    auto data = dataset.get_col<float>(fake_id);
+    std::vector<std::string> file_names;
+    for (int i = 0; i < 3; ++i) {
+        auto name = fmt::format("{}{}", file_name, i);
+        PutFieldData(lcm.get(),
+                     std::vector<void*>{data.data()},
+                     std::vector<int64_t>{static_cast<int64_t>(N)},
+                     std::vector<std::string>{name},
+                     field_data_meta,
+                     field_meta);
+        file_names.push_back(name);
+    }
+
+    // only one file fits in the cache
+    uint64_t file_bytes = uint64_t(N) * dim * sizeof(float);
+    for (const auto& policy : {"lru", "clock"}) {
+        auto cc = std::make_shared<milvus::storage::ChunkCache>(
+            DEFAULT_READ_AHEAD_POLICY, lcm, mcm, file_bytes, policy);
+        ASSERT_EQ(cc->GetCapacity(), file_bytes);
+
+        cc->Read(file_names[0], descriptor, field_meta, false);
+        ASSERT_EQ(cc->GetCachedBytes(), file_bytes);
+
+        // the first file is not held by anyone, evicted
+        cc->Read(file_names[1], descriptor, field_meta, false);
+        ASSERT_EQ(cc->GetCachedBytes(), file_bytes);
+        ASSERT_FALSE(cc->Pin(file_names[0]));
+
+        // pinned file is never evicted
+        ASSERT_TRUE(cc->Pin(file_names[1]));
+        cc->Read(file_names[2], descriptor, field_meta, false);
+        ASSERT_TRUE(cc->Pin(file_names[1]));
+        cc->Unpin(file_names[1]);
+        cc->Unpin(file_names[1]);
+
+        // column held by an in-flight reader is never evicted
+        auto column = cc->Read(file_names[1], descriptor, field_meta, false);
+        cc->Read(file_names[0], descriptor, field_meta, false);
+        ASSERT_TRUE(cc->Pin(file_names[1]));
+        cc->Unpin(file_names[1]);
+
+        auto actual = (float*)column->Data();
+        for (auto i = 0; i < N; i++) {
+            AssertInfo(data[i] == actual[i],
+                       fmt::format("expect {}, actual {}", data[i], actual[i]));
+        }
+
+        for (const auto& name : file_names) {
+            cc->Remove(name);
+        }
+        ASSERT_EQ(cc->GetCachedBytes(), 0);
+    }
+
+    for (const auto& name : file_names) {
+        lcm->Remove(name);
+    }
+}
@@ -30,6 +30,7 @@
 #include "common/FieldDataInterface.h"
 #include "common/Slice.h"
 #include "common/Common.h"
+#include "common/File.h"
 #include "common/Types.h"
 #include "storage/ChunkManager.h"
 #include "storage/DataCodec.h"
@@ -117,6 +118,49 @@ TEST_F(DiskAnnFileManagerTest, AddFilePositiveParallel) {
     }
 }
 
+TEST_F(DiskAnnFileManagerTest, DownloadToFileInOrder) {
+    FieldDataMeta field_data_meta = {1, 2, 3, 100};
+    IndexMeta index_meta = {3, 100, 1001, 1, "index"};
+
+    // slices of different size and content, more than the window
+    std::vector<std::string> remote_files;
+    std::vector<uint8_t> expected;
+    for (int i = 0; i < 7; ++i) {
+        std::vector<uint8_t> slice(1024 * (i + 1), uint8_t(i + 1));
+        expected.insert(expected.end(), slice.begin(), slice.end());
+        auto key = fmt::format(
+            "{}/pipeline_index/slice_{}", cm_->GetRootPath(), i);
+        EncodeAndUploadIndexSlice(cm_.get(),
+                                  slice.data(),
+                                  slice.size(),
+                                  index_meta,
+                                  field_data_meta,
+                                  key);
+        remote_files.push_back(key);
+    }
+
+    std::string local_file = "/tmp/diskann/pipeline_index_file";
+    auto file = File::Open(local_file, O_CREAT | O_RDWR | O_TRUNC);
+    DownloadToFileStats stats;
+    // leave a header before the slices
+    auto end = DownloadToFile(cm_.get(), remote_files, file, 16, 2, stats);
+    file.Close();
+    EXPECT_EQ(end, 16 + expected.size());
+    EXPECT_EQ(stats.bytes, expected.size());
+    // every download is timed on its own, not derived from the wall time
+    EXPECT_GT(stats.download_duration.count(), 0);
+
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    std::vector<uint8_t> actual(expected.size());
+    lcm->Read(local_file, 16, actual.data(), actual.size());
+    EXPECT_EQ(actual, expected);
+
+    lcm->Remove(local_file);
+    for (auto& remote_file : remote_files) {
+        cm_->Remove(remote_file);
+    }
+}
+
 int
 test_worker(string s) {
     std::cout << s << std::endl;
@@ -23,6 +23,7 @@
 #include "query/generated/ExecPlanNodeVisitor.h"
 #include "query/generated/ExprVisitor.h"
 #include "query/generated/ShowPlanNodeVisitor.h"
+#include "segcore/ExprResultCache.h"
 #include "segcore/SegmentSealed.h"
 #include "test_utils/AssertUtils.h"
 #include "test_utils/DataGen.h"
@@ -44,6 +45,7 @@ class TaskTest : public testing::TestWithParam<DataType> {
         using namespace milvus;
         using namespace milvus::query;
         using namespace milvus::segcore;
+        expr_result_cache_size_ = EXPR_RESULT_CACHE_SIZE;
         auto schema = std::make_shared<Schema>();
         auto vec_fid = schema->AddDebugField(
             "fakevec", GetParam(), 16, knowhere::metric::L2);
@@ -104,12 +106,15 @@ class TaskTest : public testing::TestWithParam<DataType> {
 
     void
     TearDown() override {
+        // restored even if a test failed half way
+        EXPR_RESULT_CACHE_SIZE = expr_result_cache_size_;
     }
 
  public:
     SegmentSealedSPtr segment_;
     std::map<std::string, FieldId> field_map_;
     int64_t num_rows_{0};
+    int64_t expr_result_cache_size_{0};
 };
 
 INSTANTIATE_TEST_SUITE_P(TaskTestSuite,
@@ -198,6 +203,264 @@ TEST_P(TaskTest, LogicalExpr) {
     EXPECT_EQ(num_rows, num_rows_);
 }
 
+TEST_P(TaskTest, MorselExecution) {
+    ::milvus::proto::plan::GenericValue value;
+    value.set_int64_val(0);
+    auto left = std::make_shared<milvus::expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(field_map_["int64"], DataType::INT64),
+        proto::plan::OpType::GreaterThan,
+        value);
+    auto right = std::make_shared<milvus::expr::CompareExpr>(
+        field_map_["int32"],
+        field_map_["int321"],
+        DataType::INT32,
+        DataType::INT32,
+        proto::plan::OpType::LessThan);
+    auto top = std::make_shared<milvus::expr::LogicalBinaryExpr>(
+        expr::LogicalBinaryExpr::OpType::And, left, right);
+    std::shared_ptr<milvus::plan::PlanNode> filter_node =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, top);
+
+    query::ExecPlanNodeVisitor visitor(*segment_, MAX_TIMESTAMP);
+    auto max_drivers = EXEC_EVAL_EXPR_MAX_DRIVERS;
+    BitsetType sequential;
+    EXEC_EVAL_EXPR_MAX_DRIVERS = 1;
+    visitor.ExecuteExprNode(
+        filter_node, segment_.get(), num_rows_, sequential);
+
+    BitsetType morsels;
+    EXEC_EVAL_EXPR_MAX_DRIVERS = 4;
+    visitor.ExecuteExprNode(filter_node, segment_.get(), num_rows_, morsels);
+    EXEC_EVAL_EXPR_MAX_DRIVERS = max_drivers;
+
+    ASSERT_EQ(sequential.size(), num_rows_);
+    ASSERT_EQ(morsels.size(), num_rows_);
+    EXPECT_EQ(sequential.count(), morsels.count());
+    for (int64_t i = 0; i < num_rows_; ++i) {
+        ASSERT_EQ(sequential[i], morsels[i]) << "row " << i;
+    }
+}
+
+TEST_P(TaskTest, OutputBitset) {
+    ::milvus::proto::plan::GenericValue value;
+    value.set_int64_val(0);
+    auto unary = std::make_shared<milvus::expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(field_map_["int64"], DataType::INT64),
+        proto::plan::OpType::GreaterThan,
+        value);
+    auto compare = std::make_shared<milvus::expr::CompareExpr>(
+        field_map_["int32"],
+        field_map_["int321"],
+        DataType::INT32,
+        DataType::INT32,
+        proto::plan::OpType::LessThan);
+    auto top = std::make_shared<milvus::expr::LogicalBinaryExpr>(
+        expr::LogicalBinaryExpr::OpType::And, compare, unary);
+
+    auto evaluate = [&](const expr::TypedExprPtr& filter,
+                        TargetBitmap* output) {
+        auto plan = plan::PlanFragment(
+            std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, filter));
+        auto query_context = std::make_shared<milvus::exec::QueryContext>(
+            DEAFULT_QUERY_ID, segment_.get(), num_rows_, MAX_TIMESTAMP);
+        query_context->set_output(output);
+        auto task = Task::Create(DEFAULT_TASK_ID, plan, 0, query_context);
+        TargetBitmap results;
+        std::vector<bool> written;
+        for (;;) {
+            auto result = task->Next();
+            if (!result) {
+                break;
+            }
+            auto vec = std::dynamic_pointer_cast<ColumnVector>(result->child(0));
+            written.push_back(output != nullptr &&
+                              vec->GetRawData() ==
+                                  output->data() + results.size() / 64);
+            results.append(TargetBitmapView(vec->GetRawData(), vec->size()));
+        }
+        EXPECT_EQ(results.size(), num_rows_);
+        return std::make_pair(std::move(results), written);
+    };
+
+    for (auto& filter : std::vector<expr::TypedExprPtr>{unary, top}) {
+        auto [expected, _] = evaluate(filter, nullptr);
+        TargetBitmap output(num_rows_);
+        auto [results, written] = evaluate(filter, &output);
+        for (int64_t i = 0; i < num_rows_; ++i) {
+            ASSERT_EQ(expected[i], results[i]) << "row " << i;
+        }
+        if (filter == unary) {
+            // the batches of a data scan are written straight into the output
+            for (auto batch_written : written) {
+                EXPECT_TRUE(batch_written);
+            }
+        }
+
+        query::ExecPlanNodeVisitor visitor(*segment_, MAX_TIMESTAMP);
+        BitsetType bitset;
+        visitor.ExecuteExprNode(
+            std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, filter),
+            segment_.get(),
+            num_rows_,
+            bitset);
+        ASSERT_EQ(bitset.size(), num_rows_);
+        for (int64_t i = 0; i < num_rows_; ++i) {
+            ASSERT_EQ(expected[i], bitset[i]) << "row " << i;
+        }
+    }
+}
+
+TEST_P(TaskTest, ExprResultCache) {
+    ::milvus::proto::plan::GenericValue value;
+    value.set_int64_val(0);
+    auto unary = std::make_shared<milvus::expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(field_map_["int64"], DataType::INT64),
+        proto::plan::OpType::GreaterThan,
+        value);
+    auto compare = std::make_shared<milvus::expr::CompareExpr>(
+        field_map_["int32"],
+        field_map_["int321"],
+        DataType::INT32,
+        DataType::INT32,
+        proto::plan::OpType::LessThan);
+    std::shared_ptr<milvus::plan::PlanNode> filter_node =
+        std::make_shared<plan::FilterBitsNode>(
+            DEFAULT_PLANNODE_ID,
+            std::make_shared<milvus::expr::LogicalBinaryExpr>(
+                expr::LogicalBinaryExpr::OpType::And, unary, compare));
+    // same filter with the operands swapped
+    std::shared_ptr<milvus::plan::PlanNode> swapped_node =
+        std::make_shared<plan::FilterBitsNode>(
+            DEFAULT_PLANNODE_ID,
+            std::make_shared<milvus::expr::LogicalBinaryExpr>(
+                expr::LogicalBinaryExpr::OpType::And, compare, unary));
+
+    auto cache = segment_->get_expr_result_cache();
+    ASSERT_NE(cache, nullptr);
+    EXPR_RESULT_CACHE_SIZE = 64 << 20;
+    query::ExecPlanNodeVisitor visitor(*segment_, MAX_TIMESTAMP);
+
+    BitsetType expected;
+    visitor.ExecuteExprNode(filter_node, segment_.get(), num_rows_, expected);
+    EXPECT_EQ(cache->size(), 1);
+
+    auto hits = monitor::internal_expr_result_cache_op_count_hit.Value();
+    BitsetType cached;
+    visitor.ExecuteExprNode(swapped_node, segment_.get(), num_rows_, cached);
+    EXPECT_EQ(monitor::internal_expr_result_cache_op_count_hit.Value(),
+              hits + 1);
+    ASSERT_EQ(cached.size(), num_rows_);
+    for (int64_t i = 0; i < num_rows_; ++i) {
+        ASSERT_EQ(expected[i], cached[i]) << "row " << i;
+    }
+
+    // an older snapshot of the segment reuses a prefix of the result
+    auto active_count = num_rows_ / 3;
+    BitsetType prefix;
+    visitor.ExecuteExprNode(filter_node, segment_.get(), active_count, prefix);
+    EXPECT_EQ(monitor::internal_expr_result_cache_op_count_hit.Value(),
+              hits + 2);
+    ASSERT_EQ(prefix.size(), active_count);
+    for (int64_t i = 0; i < active_count; ++i) {
+        ASSERT_EQ(expected[i], prefix[i]) << "row " << i;
+    }
+
+    // pk term filters depend on the query timestamp
+    ::milvus::proto::plan::GenericValue pk;
+    pk.set_string_val("0");
+    std::shared_ptr<milvus::plan::PlanNode> pk_node =
+        std::make_shared<plan::FilterBitsNode>(
+            DEFAULT_PLANNODE_ID,
+            std::make_shared<milvus::expr::TermFilterExpr>(
+                expr::ColumnInfo(field_map_["string1"], DataType::VARCHAR),
+                std::vector<proto::plan::GenericValue>{pk}));
+    BitsetType pk_result;
+    visitor.ExecuteExprNode(pk_node, segment_.get(), num_rows_, pk_result);
+    EXPECT_EQ(cache->size(), 1);
+
+    segment_->DropFieldData(field_map_["double"]);
+    EXPECT_EQ(cache->size(), 0);
+    EXPECT_EQ(cache->bytes(), 0);
+}
+
+class ExprResultCacheTest : public testing::Test {
+ protected:
+    void
+    SetUp() override {
+        expr_result_cache_size_ = EXPR_RESULT_CACHE_SIZE;
+        EXPR_RESULT_CACHE_SIZE = 64 << 20;
+    }
+
+    void
+    TearDown() override {
+        EXPR_RESULT_CACHE_SIZE = expr_result_cache_size_;
+    }
+
+    int64_t expr_result_cache_size_{0};
+};
+
+TEST_F(ExprResultCacheTest, NestedPathKey) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    auto json_fid = schema->AddDebugField("json", DataType::JSON);
+    schema->set_primary_field_id(pk_fid);
+    int64_t N = 1000;
+    auto segment = SealedCreator(schema, DataGen(schema, N));
+    auto cache = segment->get_expr_result_cache();
+    ASSERT_NE(cache, nullptr);
+    query::ExecPlanNodeVisitor visitor(*segment, MAX_TIMESTAMP);
+
+    // $meta["a,b"] and $meta["a"]["b"] are different filters
+    auto hits = monitor::internal_expr_result_cache_op_count_hit.Value();
+    for (auto& nested_path : std::vector<std::vector<std::string>>{
+             {"a,b"}, {"a", "b"}, {"a", "b", ""}}) {
+        std::shared_ptr<milvus::plan::PlanNode> node =
+            std::make_shared<plan::FilterBitsNode>(
+                DEFAULT_PLANNODE_ID,
+                std::make_shared<milvus::expr::ExistsExpr>(expr::ColumnInfo(
+                    json_fid, DataType::JSON, nested_path)));
+        BitsetType result;
+        visitor.ExecuteExprNode(node, segment.get(), N, result);
+    }
+    EXPECT_EQ(monitor::internal_expr_result_cache_op_count_hit.Value(), hits);
+    EXPECT_EQ(cache->size(), 3);
+}
+
+TEST_F(ExprResultCacheTest, SharedBudget) {
+    using segcore::ExprResultCache;
+    auto result = std::make_shared<const BitsetType>(64 * 1024);
+    auto first = std::make_unique<ExprResultCache>();
+    first->Put("a", result);
+    auto entry_bytes = first->bytes();
+
+    // the budget fits two results, the least recently used ones of any
+    // segment are evicted to make room, those of other tests first
+    EXPR_RESULT_CACHE_SIZE = entry_bytes * 2;
+    ExprResultCache second;
+    second.Put("a", result);
+    second.Put("b", result);
+    EXPECT_EQ(first->size(), 0);
+    EXPECT_EQ(second.size(), 2);
+    EXPECT_EQ(ExprResultCache::total_bytes(), entry_bytes * 2);
+
+    // a hit keeps a result of a segment, a put of another one evicts the
+    // colder result
+    EXPECT_NE(second.Get("a", 0), nullptr);
+    first->Put("a", result);
+    EXPECT_EQ(first->size(), 1);
+    EXPECT_NE(second.Get("a", 0), nullptr);
+    EXPECT_EQ(second.Get("b", 0), nullptr);
+    EXPECT_EQ(ExprResultCache::total_bytes(), entry_bytes * 2);
+
+    // a dropped segment gives its room back
+    first.reset();
+    EXPECT_EQ(ExprResultCache::total_bytes(), entry_bytes);
+    second.Clear();
+    EXPECT_EQ(ExprResultCache::total_bytes(), 0);
+}
+
 TEST_P(TaskTest, CompileInputs_and) {
     using namespace milvus;
     using namespace milvus::query;
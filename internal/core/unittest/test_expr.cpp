@@ -34,6 +34,7 @@
 #include "segcore/segment_c.h"
 #include "test_utils/DataGen.h"
 #include "index/IndexFactory.h"
+#include "exec/expression/ConjunctExpr.h"
 #include "exec/expression/Expr.h"
 #include "exec/Task.h"
 #include "expr/ITypeExpr.h"
@@ -1923,6 +1924,156 @@ TEST_P(ExprTest, TestConjuctExpr) {
     }
 }
 
+TEST_P(ExprTest, TestConjuctExprWithSparseActiveRows) {
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField("fakevec", data_type, 16, metric_type);
+    auto int64_fid = schema->AddDebugField("int64", DataType::INT64);
+    auto str1_fid = schema->AddDebugField("string1", DataType::VARCHAR);
+    schema->set_primary_field_id(str1_fid);
+
+    auto seg = CreateSealedSegment(schema);
+    int N = 10000;
+    auto raw_data = DataGen(schema, N);
+    auto fields = schema->get_fields();
+    for (auto field_data : raw_data.raw_->fields_data()) {
+        int64_t field_id = field_data.field_id();
+
+        auto info = FieldDataInfo(field_data.field_id(), N, "/tmp/a");
+        auto field_meta = fields.at(FieldId(field_id));
+        info.channel->push(
+            CreateFieldDataFromDataArray(N, &field_data, field_meta));
+        info.channel->close();
+
+        seg->LoadFieldData(FieldId(field_id), info);
+    }
+    query::ExecPlanNodeVisitor visitor(*seg, MAX_TIMESTAMP);
+
+    auto unary = [&](proto::plan::OpType op, int64_t v) {
+        ::milvus::proto::plan::GenericValue value;
+        value.set_int64_val(v);
+        return std::make_shared<milvus::expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(int64_fid, DataType::INT64), op, value);
+    };
+    auto term = [&](const std::vector<int64_t>& vs) {
+        std::vector<proto::plan::GenericValue> values;
+        for (auto v : vs) {
+            proto::plan::GenericValue value;
+            value.set_int64_val(v);
+            values.push_back(value);
+        }
+        return std::make_shared<milvus::expr::TermFilterExpr>(
+            expr::ColumnInfo(int64_fid, DataType::INT64), values);
+    };
+    auto logical = [](expr::LogicalBinaryExpr::OpType op,
+                      const expr::TypedExprPtr& left,
+                      const expr::TypedExprPtr& right) {
+        return std::make_shared<milvus::expr::LogicalBinaryExpr>(
+            op, left, right);
+    };
+    using LogicalOp = expr::LogicalBinaryExpr::OpType;
+
+    // the first input leaves only a few undecided rows in every batch, so
+    // the following inputs are evaluated for those rows only.
+    std::vector<std::pair<expr::TypedExprPtr, std::function<bool(int)>>>
+        test_cases = {
+            {logical(LogicalOp::And,
+                     logical(LogicalOp::Or,
+                             unary(proto::plan::OpType::LessThan, 100),
+                             unary(proto::plan::OpType::GreaterEqual, 9990)),
+                     term({5, 50, 3000, 9995})),
+             [](int i) { return i == 5 || i == 50 || i == 9995; }},
+            {logical(LogicalOp::Or,
+                     unary(proto::plan::OpType::LessThan, 9900),
+                     term({9950, 9999, 42})),
+             [](int i) { return i < 9900 || i == 9950 || i == 9999; }},
+            {logical(LogicalOp::And,
+                     unary(proto::plan::OpType::GreaterThan, 8180),
+                     logical(LogicalOp::Or,
+                             unary(proto::plan::OpType::LessThan, 8200),
+                             term({8500, 8193}))),
+             [](int i) { return i > 8180 && (i < 8200 || i == 8500); }},
+        };
+    for (auto& [expr, ref_func] : test_cases) {
+        auto plan =
+            std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+        BitsetType final;
+        visitor.ExecuteExprNode(plan, seg.get(), N, final);
+        for (int i = 0; i < N; ++i) {
+            EXPECT_EQ(final[i], ref_func(i)) << i;
+        }
+    }
+}
+
+TEST_P(ExprTest, TestConjuctExprAdaptiveOrder) {
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField("fakevec", data_type, 16, metric_type);
+    auto int64_fid = schema->AddDebugField("int64", DataType::INT64);
+    auto str1_fid = schema->AddDebugField("string1", DataType::VARCHAR);
+    schema->set_primary_field_id(str1_fid);
+
+    auto seg = CreateSealedSegment(schema);
+    int N = 30000;
+    auto raw_data = DataGen(schema, N);
+    auto fields = schema->get_fields();
+    for (auto field_data : raw_data.raw_->fields_data()) {
+        int64_t field_id = field_data.field_id();
+
+        auto info = FieldDataInfo(field_data.field_id(), N, "/tmp/a");
+        auto field_meta = fields.at(FieldId(field_id));
+        info.channel->push(
+            CreateFieldDataFromDataArray(N, &field_data, field_meta));
+        info.channel->close();
+
+        seg->LoadFieldData(FieldId(field_id), info);
+    }
+    query::ExecPlanNodeVisitor visitor(*seg, MAX_TIMESTAMP);
+
+    // an expensive term that keeps every row goes first, a cheap range that
+    // drops almost all of them second.
+    std::vector<proto::plan::GenericValue> values;
+    for (int64_t v = 0; v < N; ++v) {
+        proto::plan::GenericValue value;
+        value.set_int64_val(v);
+        values.push_back(value);
+    }
+    auto term = std::make_shared<milvus::expr::TermFilterExpr>(
+        expr::ColumnInfo(int64_fid, DataType::INT64), values);
+    proto::plan::GenericValue upper_value;
+    upper_value.set_int64_val(100);
+    auto range = std::make_shared<milvus::expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(int64_fid, DataType::INT64),
+        proto::plan::OpType::LessThan,
+        upper_value);
+    auto expr = std::make_shared<milvus::expr::LogicalBinaryExpr>(
+        expr::LogicalBinaryExpr::OpType::And, term, range);
+
+    // the range moves to the front once the costs of a batch are known
+    auto query_context = std::make_shared<milvus::exec::QueryContext>(
+        DEAFULT_QUERY_ID, seg.get(), N, MAX_TIMESTAMP);
+    milvus::exec::ExecContext exec_context(query_context.get());
+    milvus::exec::ExprSet expr_set({expr}, &exec_context);
+    auto conjunct =
+        std::dynamic_pointer_cast<milvus::exec::PhyConjunctFilterExpr>(
+            expr_set.exprs()[0]);
+    ASSERT_NE(conjunct, nullptr);
+    EXPECT_EQ(conjunct->input_order(), std::vector<int32_t>({0, 1}));
+    std::vector<VectorPtr> results;
+    for (int batch = 0; batch < 3; ++batch) {
+        milvus::exec::EvalCtx eval_ctx(&exec_context, &expr_set, nullptr);
+        expr_set.Eval(0, 1, true, eval_ctx, results);
+        EXPECT_EQ(conjunct->input_order(), std::vector<int32_t>({1, 0}))
+            << "batch " << batch;
+    }
+
+    auto plan =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+    BitsetType final;
+    visitor.ExecuteExprNode(plan, seg.get(), N, final);
+    for (int i = 0; i < N; ++i) {
+        EXPECT_EQ(final[i], i < 100) << i;
+    }
+}
+
 TEST_P(ExprTest, TestUnaryBenchTest) {
     auto schema = std::make_shared<Schema>();
     auto vec_fid = schema->AddDebugField("fakevec", data_type, 16, metric_type);
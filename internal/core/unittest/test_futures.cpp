@@ -10,11 +10,15 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <gtest/gtest.h>
+#include "futures/Executor.h"
 #include "futures/Future.h"
 #include <folly/executors/CPUThreadPoolExecutor.h>
 #include <stdlib.h>
 #include <mutex>
 #include <exception>
+#include <functional>
+#include <numeric>
+#include <thread>
 
 using namespace milvus::futures;
 
@@ -208,4 +212,49 @@ TEST(Futures, Future) {
         ASSERT_EQ(s.error_code, milvus::FollyCancel);
         free((char*)(s.error_msg));
     }
-}
\ No newline at end of file
+}
+TEST(Futures, ParallelForEach) {
+    int64_t num_tasks = 1000;
+    std::vector<std::atomic<int64_t>> hits(num_tasks);
+    ParallelForEach(num_tasks, 4, [&](int64_t i) { hits[i]++; });
+    for (auto& hit : hits) {
+        ASSERT_EQ(hit.load(), 1);
+    }
+
+    // per-worker state needs no locking
+    std::vector<int64_t> sums(4, 0);
+    ParallelForEach(num_tasks, 4, [&](int64_t i, int64_t worker_id) {
+        sums[worker_id] += i;
+    });
+    ASSERT_EQ(std::accumulate(sums.begin(), sums.end(), int64_t(0)),
+              num_tasks * (num_tasks - 1) / 2);
+
+    // helpers that never run don't block the loop
+    std::vector<std::function<void()>> never_run;
+    std::atomic<int64_t> count{0};
+    ParallelForEach(
+        num_tasks,
+        4,
+        [&](auto worker) { never_run.emplace_back(std::move(worker)); },
+        [&](int64_t) { count++; });
+    ASSERT_EQ(count.load(), num_tasks);
+    ASSERT_EQ(never_run.size(), 3);
+
+    // the first failure is rethrown after every task is done
+    std::vector<std::thread> threads;
+    count = 0;
+    ASSERT_ANY_THROW(ParallelForEach(
+        num_tasks,
+        4,
+        [&](auto worker) { threads.emplace_back(std::move(worker)); },
+        [&](int64_t i) {
+            count++;
+            if (i % 100 == 0) {
+                throw std::runtime_error("task failed");
+            }
+        }));
+    ASSERT_EQ(count.load(), num_tasks);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 #include "common/Schema.h"
+#include "index/StringIndexMarisa.h"
 #include "query/Plan.h"
 #include "segcore/SegmentSealedImpl.h"
 #include "segcore/reduce_c.h"
@@ -838,4 +839,99 @@ TEST(GroupBY, GrowingIndex) {
             ASSERT_EQ(group_size, map_pair.second);
         }
     }
-}
\ No newline at end of file
+}
+
+TEST(GroupBY, SealedStringIndexMarisa) {
+    using namespace milvus;
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    //0. prepare schema
+    int dim = 64;
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto int64_fid = schema->AddDebugField("int64", DataType::INT64);
+    auto str_fid = schema->AddDebugField("string1", DataType::VARCHAR);
+    schema->set_primary_field_id(int64_fid);
+    // data_segment holds the raw strings, index_segment only a marisa index
+    auto data_segment = CreateSealedSegment(schema);
+    auto index_segment = CreateSealedSegment(schema);
+    size_t N = 100;
+
+    //1. load raw data
+    auto raw_data = DataGen(schema, N, 42, 0, 8, 10, false, false);
+    auto fields = schema->get_fields();
+    for (auto field_data : raw_data.raw_->fields_data()) {
+        int64_t field_id = field_data.field_id();
+        auto field_meta = fields.at(FieldId(field_id));
+        for (auto segment : {data_segment.get(), index_segment.get()}) {
+            if (segment == index_segment.get() &&
+                FieldId(field_id) == str_fid) {
+                continue;
+            }
+            auto info = FieldDataInfo(field_data.field_id(), N);
+            info.channel->push(
+                CreateFieldDataFromDataArray(N, &field_data, field_meta));
+            info.channel->close();
+            segment->LoadFieldData(FieldId(field_id), info);
+        }
+    }
+    prepareSegmentSystemFieldData(data_segment, N, raw_data);
+    prepareSegmentSystemFieldData(index_segment, N, raw_data);
+
+    //2. load marisa index for the string field
+    auto str_col = raw_data.get_col<std::string>(str_fid);
+    auto str_index = index::CreateStringIndexMarisa();
+    str_index->Build(N, str_col.data());
+    LoadIndexInfo load_index_info;
+    load_index_info.field_id = str_fid.get();
+    load_index_info.field_type = DataType::VARCHAR;
+    load_index_info.index = std::move(str_index);
+    index_segment->LoadIndex(load_index_info);
+    ASSERT_FALSE(index_segment->HasFieldData(str_fid));
+
+    //3. search group by string on both segments with several queries
+    const char* raw_plan = R"(vector_anns: <
+                                    field_id: 100
+                                    query_info: <
+                                      topk: 10
+                                      metric_type: "L2"
+                                      search_params: "{\"ef\": 10}"
+                                      group_by_field_id: 102,
+                                      group_size: 2,
+                                      group_strict_size: true,
+                                    >
+                                    placeholder_tag: "$0"
+
+     >)";
+    auto plan_str = translate_text_plan_to_binary_plan(raw_plan);
+    auto plan =
+        CreateSearchPlanByExpr(*schema, plan_str.data(), plan_str.size());
+    auto num_queries = 5;
+    auto seed = 1024;
+    auto ph_group_raw = CreatePlaceholderGroup(num_queries, dim, seed);
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+    auto data_result =
+        data_segment->Search(plan.get(), ph_group.get(), 1L << 63);
+    auto index_result =
+        index_segment->Search(plan.get(), ph_group.get(), 1L << 63);
+    CheckGroupBySearchResult(*data_result, 10, num_queries, true);
+    CheckGroupBySearchResult(*index_result, 10, num_queries, true);
+
+    //4. grouping by marisa key ids must give the same result as raw strings
+    ASSERT_EQ(data_result->topk_per_nq_prefix_sum_,
+              index_result->topk_per_nq_prefix_sum_);
+    ASSERT_EQ(data_result->seg_offsets_, index_result->seg_offsets_);
+    ASSERT_EQ(data_result->distances_, index_result->distances_);
+    auto& data_values = data_result->group_by_values_.value();
+    auto& index_values = index_result->group_by_values_.value();
+    ASSERT_EQ(data_values.size(), index_values.size());
+    for (size_t i = 0; i < data_values.size(); i++) {
+        ASSERT_EQ(std::get<std::string>(data_values[i]),
+                  std::get<std::string>(index_values[i]));
+        ASSERT_EQ(std::get<std::string>(index_values[i]),
+                  str_col[data_result->seg_offsets_[i]]);
+    }
+}
@@ -16,6 +16,7 @@
 #include "segcore/SegmentGrowing.h"
 #include "segcore/SegmentGrowingImpl.h"
 #include "pb/schema.pb.h"
+#include "query/Plan.h"
 #include "test_utils/DataGen.h"
 
 using namespace milvus::segcore;
@@ -436,3 +437,75 @@ TEST(Growing, FillNullableData) {
         EXPECT_EQ(float_array_result->valid_data_size(), num_inserted);
     }
 }
+
+TEST(Growing, ParallelSearchMatchesSerial) {
+    int64_t dim = 16;
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+
+    // the last chunk is partial, and every vector repeats every 97 rows, so
+    // the top k of a query are ties spread over all chunks
+    auto config = SegcoreConfig::default_config();
+    config.set_chunk_rows(1024);
+    int64_t N = 10 * 1024 + 77;
+    auto dataset = DataGen(schema, N);
+    for (auto& field_data : *dataset.raw_->mutable_fields_data()) {
+        if (field_data.field_id() != vec_fid.get()) {
+            continue;
+        }
+        auto data = field_data.mutable_vectors()
+                        ->mutable_float_vector()
+                        ->mutable_data();
+        for (int64_t i = 97; i < N; ++i) {
+            for (int64_t j = 0; j < dim; ++j) {
+                data->Set(i * dim + j, data->Get((i % 97) * dim + j));
+            }
+        }
+    }
+    auto segment = CreateGrowingSegment(schema, empty_index_meta, 1, config);
+    segment->PreInsert(N);
+    segment->Insert(0,
+                    N,
+                    dataset.row_ids_.data(),
+                    dataset.timestamps_.data(),
+                    dataset.raw_);
+
+    const char* raw_plan = R"(vector_anns: <
+                                    field_id: 100
+                                    query_info: <
+                                      topk: 150
+                                      round_decimal: -1
+                                      metric_type: "L2"
+                                      search_params: "{\"nprobe\": 10}"
+                                    >
+                                    placeholder_tag: "$0"
+        >)";
+    auto plan_str = translate_text_plan_to_binary_plan(raw_plan);
+    auto plan = query::CreateSearchPlanByExpr(
+        *schema, plan_str.data(), plan_str.size());
+    int64_t num_queries = 5;
+    auto vecs = dataset.get_col<float>(vec_fid);
+    auto ph_group_raw =
+        CreatePlaceholderGroupFromBlob(num_queries, dim, vecs.data());
+    auto ph_group = query::ParsePlaceholderGroup(
+        plan.get(), ph_group_raw.SerializeAsString());
+
+    auto default_parallelism = config.get_growing_search_parallelism();
+    auto search = [&](int64_t parallelism) {
+        config.set_growing_search_parallelism(parallelism);
+        return segment->Search(plan.get(), ph_group.get(), MAX_TIMESTAMP);
+    };
+    auto serial = search(1);
+    ASSERT_EQ(serial->seg_offsets_.size(), num_queries * 150);
+    for (int64_t parallelism : {2, 3, 4, 16}) {
+        auto parallel = search(parallelism);
+        ASSERT_EQ(parallel->seg_offsets_, serial->seg_offsets_)
+            << "parallelism: " << parallelism;
+        ASSERT_EQ(parallel->distances_, serial->distances_)
+            << "parallelism: " << parallelism;
+    }
+    config.set_growing_search_parallelism(default_parallelism);
+}
@@ -21,7 +21,12 @@
 #include "indexbuilder/IndexFactory.h"
 #include "index/IndexFactory.h"
 #include "test_utils/indexbuilder_test_utils.h"
+#include "test_utils/DataGen.h"
 #include "index/Meta.h"
+#include "exec/expression/Expr.h"
+#include "expr/ITypeExpr.h"
+#include "query/generated/ExecPlanNodeVisitor.h"
+#include "segcore/SegmentSealedImpl.h"
 
 using namespace milvus;
 
@@ -666,3 +671,179 @@ TEST(InvertedIndex, Naive) {
 
     test_string<true>();
 }
+
+TEST(InvertedIndex, JsonPath) {
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    auto json_fid = schema->AddDebugField("json", DataType::JSON);
+    schema->set_primary_field_id(pk_fid);
+
+    int64_t N = 1000;
+    auto dataset = segcore::DataGen(schema, N);
+    auto json_col = dataset.get_col<std::string>(json_fid);
+    // rows missing the path are indexed without a value
+    for (int64_t i = 0; i < N; i += 7) {
+        json_col[i] = R"({"other": 1})";
+    }
+    // 2^53 + 1 is indexed as the double 2^53
+    json_col[8] = R"({"int": 9007199254740993})";
+    for (auto& field_data : *dataset.raw_->mutable_fields_data()) {
+        if (field_data.field_id() == json_fid.get()) {
+            auto data = field_data.mutable_scalars()->mutable_json_data();
+            *data->mutable_data() = {json_col.begin(), json_col.end()};
+        }
+    }
+
+    int64_t collection_id = 1;
+    int64_t partition_id = 2;
+    int64_t segment_id = 3;
+    auto field_meta = test::gen_field_meta(collection_id,
+                                           partition_id,
+                                           segment_id,
+                                           json_fid.get(),
+                                           DataType::JSON);
+    auto index_meta = test::gen_index_meta(segment_id, json_fid.get());
+    auto cm = storage::CreateChunkManager(
+        test::gen_local_storage_config("/tmp/test-json-inverted-index/"));
+    auto cm_w = test::ChunkManagerWrapper(cm);
+
+    std::vector<Json> jsons;
+    for (auto& json : json_col) {
+        jsons.emplace_back(simdjson::padded_string(json));
+    }
+    auto field_data = storage::CreateFieldData(DataType::JSON);
+    field_data->FillFieldData(jsons.data(), jsons.size());
+    storage::InsertData insert_data(field_data);
+    insert_data.SetFieldDataMeta(field_meta);
+    insert_data.SetTimestamps(0, 100);
+    auto serialized_bytes = insert_data.Serialize(storage::Remote);
+    auto log_path = fmt::format("{}/{}/{}/{}/{}",
+                                collection_id,
+                                partition_id,
+                                segment_id,
+                                json_fid.get(),
+                                0);
+    cm_w.Write(log_path, serialized_bytes.data(), serialized_bytes.size());
+
+    storage::FileManagerContext ctx(field_meta, index_meta, cm);
+    std::vector<std::string> index_files;
+    {
+        Config config;
+        config["index_type"] = milvus::index::INVERTED_INDEX_TYPE;
+        config["insert_files"] = std::vector<std::string>{log_path};
+        config[milvus::index::JSON_PATH] = "/int";
+        config[milvus::index::JSON_CAST_TYPE] = "DOUBLE";
+        auto index = indexbuilder::IndexFactory::GetInstance().CreateIndex(
+            DataType::JSON, config, ctx);
+        index->Build();
+        auto bs = index->Upload();
+        for (const auto& [key, _] : bs.binary_map_) {
+            index_files.push_back(key);
+        }
+    }
+
+    index::CreateIndexInfo index_info{};
+    index_info.index_type = milvus::index::INVERTED_INDEX_TYPE;
+    index_info.field_type = DataType::JSON;
+    index_info.json_path = "/int";
+    index_info.json_cast_type = DataType::DOUBLE;
+    Config config;
+    config["index_files"] = index_files;
+    auto index =
+        index::IndexFactory::GetInstance().CreateIndex(index_info, ctx);
+    index->Load(milvus::tracer::TraceContext{}, config);
+    ASSERT_EQ(index->Count(), N);
+
+    auto indexed = segcore::CreateSealedSegment(schema);
+    auto raw = segcore::CreateSealedSegment(schema);
+    segcore::SealedLoadFieldData(dataset, *indexed);
+    segcore::SealedLoadFieldData(dataset, *raw);
+    segcore::LoadIndexInfo load_info;
+    load_info.field_id = json_fid.get();
+    load_info.field_type = DataType::JSON;
+    load_info.index_params[milvus::index::JSON_PATH] = "/int";
+    load_info.index = std::move(index);
+    indexed->LoadIndex(load_info);
+    ASSERT_NE(indexed->GetJsonIndex(json_fid, "/int"), nullptr);
+    ASSERT_EQ(indexed->GetJsonIndex(json_fid, "/double"), nullptr);
+
+    auto execute = [&](const segcore::SegmentSealed& segment,
+                       const expr::TypedExprPtr& expr) {
+        query::ExecPlanNodeVisitor visitor(segment, MAX_TIMESTAMP);
+        BitsetType final;
+        auto plan =
+            std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+        visitor.ExecuteExprNode(plan, &segment, N, final);
+        return final;
+    };
+
+    auto pivot = Json(simdjson::padded_string(json_col[1]))
+                     .template at<int64_t>("/int")
+                     .value();
+    proto::plan::GenericValue value;
+    value.set_int64_val(pivot);
+    for (auto op : {OpType::GreaterThan,
+                    OpType::GreaterEqual,
+                    OpType::LessThan,
+                    OpType::LessEqual,
+                    OpType::Equal,
+                    OpType::NotEqual}) {
+        auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(json_fid, DataType::JSON, {"int"}), op, value);
+        auto expected = execute(*raw, expr);
+        auto res = execute(*indexed, expr);
+        ASSERT_EQ(res.size(), N);
+        ASSERT_TRUE(res == expected) << "op: " << op;
+        ASSERT_TRUE(op != OpType::Equal || res.count() >= 1);
+    }
+
+    std::vector<proto::plan::GenericValue> values;
+    for (int64_t i : {1, 2, 3, 4, 5, 6}) {
+        proto::plan::GenericValue value;
+        value.set_int64_val(Json(simdjson::padded_string(json_col[i]))
+                                .template at<int64_t>("/int")
+                                .value());
+        values.push_back(value);
+    }
+    auto term_expr = std::make_shared<expr::TermFilterExpr>(
+        expr::ColumnInfo(json_fid, DataType::JSON, {"int"}), values);
+    auto expected = execute(*raw, term_expr);
+    auto res = execute(*indexed, term_expr);
+    ASSERT_TRUE(res == expected);
+    ASSERT_GE(res.count(), values.size());
+
+    // an operand at 2^53 can't tell the rounded integers apart from it
+    proto::plan::GenericValue bound;
+    bound.set_int64_val(int64_t(1) << 53);
+    for (auto op : {OpType::Equal, OpType::LessEqual, OpType::GreaterThan}) {
+        auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(json_fid, DataType::JSON, {"int"}), op, bound);
+        ASSERT_TRUE(execute(*indexed, expr) == execute(*raw, expr))
+            << "op: " << op;
+    }
+    auto bound_term_expr = std::make_shared<expr::TermFilterExpr>(
+        expr::ColumnInfo(json_fid, DataType::JSON, {"int"}),
+        std::vector<proto::plan::GenericValue>{bound});
+    ASSERT_TRUE(execute(*indexed, bound_term_expr) ==
+                execute(*raw, bound_term_expr));
+
+    // the index answers the whole segment at once, splitting it into
+    // morsels would repeat the lookup for every morsel
+    auto support_morsels = [&](const segcore::SegmentSealed& segment,
+                               const expr::TypedExprPtr& expr) {
+        return milvus::exec::SupportMorselExecution(expr, segment);
+    };
+    auto unary_expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(json_fid, DataType::JSON, {"int"}),
+        OpType::GreaterThan,
+        value);
+    auto other_path_expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(json_fid, DataType::JSON, {"double"}),
+        OpType::GreaterThan,
+        value);
+    ASSERT_TRUE(support_morsels(*raw, unary_expr));
+    ASSERT_TRUE(support_morsels(*raw, term_expr));
+    ASSERT_FALSE(support_morsels(*indexed, unary_expr));
+    ASSERT_FALSE(support_morsels(*indexed, term_expr));
+    ASSERT_TRUE(support_morsels(*indexed, other_path_expr));
+}
@@ -16,7 +16,12 @@
 #include <string>
 #include <vector>
 
+#include <parquet/arrow/reader.h>
+
+#include "storage/InsertData.h"
 #include "storage/LocalChunkManagerSingleton.h"
+#include "storage/PayloadStream.h"
+#include "storage/Util.h"
 
 using namespace std;
 using namespace milvus;
@@ -24,6 +29,27 @@ using namespace milvus::storage;
 
 class LocalChunkManagerTest : public testing::Test {};
 
+// local chunk manager that records every ranged read, stands in for the
+// remote chunk managers
+class RangeCountingChunkManager : public LocalChunkManager {
+ public:
+    using LocalChunkManager::LocalChunkManager;
+    using LocalChunkManager::Read;
+
+    uint64_t
+    Read(const std::string& filepath,
+         uint64_t offset,
+         void* buf,
+         uint64_t len) override {
+        read_count_++;
+        read_bytes_ += len;
+        return LocalChunkManager::Read(filepath, offset, buf, len);
+    }
+
+    int64_t read_count_ = 0;
+    uint64_t read_bytes_ = 0;
+};
+
 TEST_F(LocalChunkManagerTest, DirPositive) {
     auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
     string test_dir = lcm->GetRootPath() + "/local-test-dir/";
@@ -138,6 +164,24 @@ TEST_F(LocalChunkManagerTest, ReadPositive) {
     EXPECT_EQ(exist, false);
 }
 
+TEST_F(LocalChunkManagerTest, ReadAll) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    string test_dir = lcm->GetRootPath() + "/local-test-dir";
+
+    uint8_t data[5] = {0x17, 0x32, 0x00, 0x34, 0x23};
+    string path = test_dir + "/test-read-all";
+    lcm->CreateFile(path);
+    lcm->Write(path, data, sizeof(data));
+
+    auto [buf, size] = lcm->ReadAll(path);
+    EXPECT_EQ(size, sizeof(data));
+    for (size_t i = 0; i < sizeof(data); ++i) {
+        EXPECT_EQ(buf[i], data[i]);
+    }
+
+    lcm->RemoveDir(test_dir);
+}
+
 TEST_F(LocalChunkManagerTest, WriteOffset) {
     auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
     string test_dir = lcm->GetRootPath() + "/local-test-dir";
@@ -250,3 +294,255 @@ TEST_F(LocalChunkManagerTest, GetSizeOfDir) {
     exist = lcm->DirExist(test_dir);
     EXPECT_EQ(exist, false);
 }
+
+TEST_F(LocalChunkManagerTest, ReadRanges) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    auto cm = std::make_shared<RangeCountingChunkManager>(lcm->GetRootPath());
+    string test_dir = lcm->GetRootPath() + "/local-test-dir";
+    string file = test_dir + "/test-read-ranges";
+
+    std::vector<uint8_t> data(1 << 20);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = i % 251;
+    }
+    lcm->Write(file, data.data(), data.size());
+
+    // the first three ranges are merged, the last one is far away
+    std::vector<std::vector<uint8_t>> bufs = {
+        std::vector<uint8_t>(100),
+        std::vector<uint8_t>(200),
+        std::vector<uint8_t>(50),
+        std::vector<uint8_t>(300),
+    };
+    std::vector<ReadRange> ranges = {
+        {1000, 200, bufs[1].data()},
+        {0, 100, bufs[0].data()},
+        {1100, 50, bufs[2].data()},
+        {900 * 1024, 300, bufs[3].data()},
+    };
+    cm->ReadRanges(file, ranges, 4096);
+    EXPECT_EQ(cm->read_count_, 2);
+    EXPECT_EQ(cm->read_bytes_, 1200 + 300);
+    for (const auto& range : ranges) {
+        EXPECT_EQ(memcmp(range.buf, data.data() + range.offset, range.len),
+                  0);
+    }
+
+    // no merge at all
+    cm->read_count_ = 0;
+    cm->ReadRanges(file, ranges, 0);
+    EXPECT_EQ(cm->read_count_, 3);
+
+    // empty ranges are not read at all
+    cm->read_count_ = 0;
+    cm->read_bytes_ = 0;
+    std::vector<ReadRange> empty_ranges = {
+        {500 * 1024, 0, bufs[0].data()},
+        {0, 0, bufs[1].data()},
+    };
+    cm->ReadRanges(file, empty_ranges, 0);
+    EXPECT_EQ(cm->read_count_, 0);
+    EXPECT_EQ(cm->read_bytes_, 0);
+
+    lcm->RemoveDir(test_dir);
+}
+
+TEST_F(LocalChunkManagerTest, ReadBinlogPayloadByRange) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    auto cm = std::make_shared<RangeCountingChunkManager>(lcm->GetRootPath());
+    string test_dir = lcm->GetRootPath() + "/local-test-dir";
+    string file = test_dir + "/test-binlog-payload";
+
+    std::vector<int64_t> data(100000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = i;
+    }
+    auto field_data = CreateFieldData(DataType::INT64, false);
+    field_data->FillFieldData(data.data(), data.size());
+    InsertData insert_data(field_data);
+    FieldDataMeta field_data_meta{100, 101, 102, 103};
+    insert_data.SetFieldDataMeta(field_data_meta);
+    insert_data.SetTimestamps(0, 100);
+    auto serialized = insert_data.Serialize(StorageType::Remote);
+    lcm->Write(file, serialized.data(), serialized.size());
+
+    auto [offset, size] = GetRemoteBinlogPayloadRange(cm.get(), file);
+    EXPECT_EQ(offset + size, serialized.size());
+
+    auto stream = std::make_shared<RemoteInputStream>(cm, file, offset, size);
+    parquet::arrow::FileReaderBuilder reader_builder;
+    ASSERT_TRUE(reader_builder.Open(stream).ok());
+    std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
+    ASSERT_TRUE(reader_builder.Build(&arrow_reader).ok());
+
+    // only the footer and the last row group are fetched
+    auto num_row_groups = arrow_reader->num_row_groups();
+    cm->read_bytes_ = 0;
+    std::shared_ptr<arrow::Table> table;
+    ASSERT_TRUE(arrow_reader->ReadRowGroup(num_row_groups - 1, &table).ok());
+    EXPECT_GT(table->num_rows(), 0);
+    if (num_row_groups > 1) {
+        EXPECT_LT(cm->read_bytes_, size);
+    }
+    auto column = std::static_pointer_cast<arrow::Int64Array>(
+        table->column(0)->chunk(0));
+    auto first = data.size() - table->num_rows();
+    for (int64_t i = 0; i < column->length(); ++i) {
+        EXPECT_EQ(column->Value(i), data[first + i]);
+    }
+
+    lcm->RemoveDir(test_dir);
+}
+
+TEST_F(LocalChunkManagerTest, RemoteInputStream) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    auto cm = std::make_shared<RangeCountingChunkManager>(lcm->GetRootPath());
+    string test_dir = lcm->GetRootPath() + "/local-test-dir";
+    string file = test_dir + "/test-remote-input-stream";
+
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = i % 251;
+    }
+    lcm->Write(file, data.data(), data.size());
+
+    // the stream covers [100, 600) of the file
+    RemoteInputStream stream(cm, file, 100, 500);
+    EXPECT_EQ(stream.GetSize().ValueOrDie(), 500);
+    EXPECT_EQ(stream.Tell().ValueOrDie(), 0);
+
+    std::vector<uint8_t> buf(1000);
+    EXPECT_EQ(stream.Read(200, buf.data()).ValueOrDie(), 200);
+    EXPECT_EQ(memcmp(buf.data(), data.data() + 100, 200), 0);
+    EXPECT_EQ(stream.Tell().ValueOrDie(), 200);
+
+    // reads are cut at the end of the stream, not of the file
+    auto tail = stream.Read(1000).ValueOrDie();
+    EXPECT_EQ(tail->size(), 300);
+    EXPECT_EQ(memcmp(tail->data(), data.data() + 300, 300), 0);
+    EXPECT_EQ(stream.Tell().ValueOrDie(), 500);
+    EXPECT_EQ(stream.Read(10, buf.data()).ValueOrDie(), 0);
+
+    EXPECT_EQ(stream.ReadAt(450, 100, buf.data()).ValueOrDie(), 50);
+    EXPECT_EQ(memcmp(buf.data(), data.data() + 550, 50), 0);
+    EXPECT_FALSE(stream.ReadAt(501, 1, buf.data()).ok());
+    EXPECT_FALSE(stream.Seek(-1).ok());
+    EXPECT_TRUE(stream.Seek(10).ok());
+    EXPECT_EQ(stream.Tell().ValueOrDie(), 10);
+
+    // a stream past the end of the file returns the bytes the file holds
+    RemoteInputStream past_end(cm, file, 900, 500);
+    EXPECT_EQ(past_end.ReadAt(0, 500).ValueOrDie()->size(), 100);
+
+    // chunk manager errors surface as arrow errors
+    RemoteInputStream missing(cm, test_dir + "/missing", 0, 100);
+    EXPECT_FALSE(missing.ReadAt(0, 10, buf.data()).ok());
+
+    EXPECT_FALSE(stream.closed());
+    EXPECT_TRUE(stream.Close().ok());
+    EXPECT_TRUE(stream.closed());
+
+    lcm->RemoveDir(test_dir);
+}
+
+TEST_F(LocalChunkManagerTest, GetRemoteBinlogPayloadRangeOfLocalBinlog) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    string test_dir = lcm->GetRootPath() + "/local-test-dir";
+    string file = test_dir + "/test-local-binlog";
+
+    std::vector<int64_t> data(100);
+    auto field_data = CreateFieldData(DataType::INT64, false);
+    field_data->FillFieldData(data.data(), data.size());
+    InsertData insert_data(field_data);
+    FieldDataMeta field_data_meta{100, 101, 102, 103};
+    insert_data.SetFieldDataMeta(field_data_meta);
+    insert_data.SetTimestamps(0, 100);
+    auto serialized = insert_data.Serialize(StorageType::LocalDisk);
+    lcm->Write(file, serialized.data(), serialized.size());
+
+    // local binlogs have no event headers to locate the payload with
+    EXPECT_ANY_THROW(GetRemoteBinlogPayloadRange(lcm.get(), file));
+
+    lcm->RemoveDir(test_dir);
+}
+
+TEST_F(LocalChunkManagerTest, DownloadAndDecodeRemoteFileInto) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    auto cm = std::make_shared<RangeCountingChunkManager>(lcm->GetRootPath());
+    string test_dir = lcm->GetRootPath() + "/local-test-dir";
+    string file = test_dir + "/test-decode-by-range";
+
+    std::vector<int64_t> data(100000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = i;
+    }
+    auto field_data = CreateFieldData(DataType::INT64, false);
+    field_data->FillFieldData(data.data(), data.size());
+    InsertData insert_data(field_data);
+    FieldDataMeta field_data_meta{100, 101, 102, 103};
+    insert_data.SetFieldDataMeta(field_data_meta);
+    insert_data.SetTimestamps(0, 100);
+    auto serialized = insert_data.Serialize(StorageType::Remote);
+    lcm->Write(file, serialized.data(), serialized.size());
+
+    // one window for all row groups, and one window per row group
+    for (int64_t window_bytes : {int64_t(64) << 20, int64_t(1)}) {
+        std::vector<int64_t> decoded(data.size());
+        PayloadDecodeTarget target{reinterpret_cast<char*>(decoded.data()),
+                                   nullptr,
+                                   sizeof(int64_t),
+                                   int64_t(decoded.size())};
+        auto num_rows =
+            DownloadAndDecodeRemoteFileInto(cm, file, target, window_bytes);
+        EXPECT_EQ(num_rows, int64_t(data.size()));
+        EXPECT_EQ(decoded, data);
+    }
+
+    // the capacity of target is checked before any column chunk is fetched
+    std::vector<int64_t> small(10);
+    PayloadDecodeTarget small_target{
+        reinterpret_cast<char*>(small.data()), nullptr, sizeof(int64_t), 10};
+    EXPECT_ANY_THROW(
+        DownloadAndDecodeRemoteFileInto(cm, file, small_target, 1 << 20));
+
+    lcm->RemoveDir(test_dir);
+}
+
+TEST_F(LocalChunkManagerTest, RemoteInputStreamWillNeed) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    auto cm = std::make_shared<RangeCountingChunkManager>(lcm->GetRootPath());
+    string test_dir = lcm->GetRootPath() + "/local-test-dir";
+    string file = test_dir + "/test-remote-input-stream-will-need";
+
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = i % 251;
+    }
+    lcm->Write(file, data.data(), data.size());
+
+    // adjacent ranges are fetched in one request, the one past the end of
+    // the stream is cut
+    RemoteInputStream stream(cm, file, 100, 500);
+    ASSERT_TRUE(stream.WillNeed({{0, 100}, {100, 50}, {450, 100}}).ok());
+    EXPECT_EQ(cm->read_count_, 1);
+
+    std::vector<uint8_t> buf(100);
+    EXPECT_EQ(stream.ReadAt(20, 80, buf.data()).ValueOrDie(), 80);
+    EXPECT_EQ(memcmp(buf.data(), data.data() + 120, 80), 0);
+    auto tail = stream.ReadAt(460, 100).ValueOrDie();
+    EXPECT_EQ(tail->size(), 40);
+    EXPECT_EQ(memcmp(tail->data(), data.data() + 560, 40), 0);
+    EXPECT_EQ(cm->read_count_, 1);
+
+    // reads out of the prefetched ranges go to chunk manager
+    EXPECT_EQ(stream.ReadAt(200, 10, buf.data()).ValueOrDie(), 10);
+    EXPECT_EQ(memcmp(buf.data(), data.data() + 300, 10), 0);
+    EXPECT_EQ(cm->read_count_, 2);
+
+    // the next WillNeed drops the previous ranges
+    ASSERT_TRUE(stream.WillNeed({{300, 10}}).ok());
+    EXPECT_EQ(stream.ReadAt(0, 10, buf.data()).ValueOrDie(), 10);
+    EXPECT_EQ(cm->read_count_, 4);
+
+    lcm->RemoveDir(test_dir);
+}
@@ -193,6 +193,24 @@ TEST_F(MinioChunkManagerTest, ReadPositive) {
     EXPECT_EQ(readdata[1], 0x32);
     EXPECT_EQ(readdata[2], 0x45);
 
+    // a range past the end returns the bytes the object holds
+    size = chunk_manager_->Read(path, 2, readdata, sizeof(readdata));
+    EXPECT_EQ(size, sizeof(data) - 2);
+    EXPECT_EQ(readdata[0], 0x45);
+    EXPECT_EQ(readdata[2], 0x23);
+
+    // an empty range reads nothing instead of the whole object
+    uint8_t untouched[5] = {0};
+    size = chunk_manager_->Read(path, 2, untouched, 0);
+    EXPECT_EQ(size, 0);
+    EXPECT_EQ(untouched[0], 0);
+    EXPECT_EQ(untouched[4], 0);
+
+    auto [all, all_size] = chunk_manager_->ReadAll(path);
+    EXPECT_EQ(all_size, sizeof(data));
+    EXPECT_EQ(all[0], 0x17);
+    EXPECT_EQ(all[4], 0x23);
+
     uint8_t dataWithNULL[] = {0x17, 0x32, 0x00, 0x34, 0x23};
     chunk_manager_->Write(path, dataWithNULL, sizeof(dataWithNULL));
     exist = chunk_manager_->Exist(path);
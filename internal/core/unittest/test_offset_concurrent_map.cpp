@@ -0,0 +1,245 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include "segcore/InsertRecord.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+template <typename T>
+class TypedOffsetConcurrentMapTest : public testing::Test {
+ public:
+    void
+    SetUp() override {
+        er = std::default_random_engine(42);
+    }
+
+    void
+    TearDown() override {
+    }
+
+ protected:
+    void
+    insert(T pk) {
+        map_.insert(pk, offset_++);
+        data_.push_back(pk);
+        std::sort(data_.begin(), data_.end());
+    }
+
+    std::vector<T>
+    random_generate(int num) {
+        std::vector<T> res;
+        for (int i = 0; i < num; i++) {
+            if constexpr (std::is_same_v<std::string, T>) {
+                res.push_back(std::to_string(er()));
+            } else {
+                res.push_back(static_cast<T>(er()));
+            }
+        }
+        return res;
+    }
+
+ protected:
+    int64_t offset_ = 0;
+    std::vector<T> data_;
+    milvus::segcore::OffsetConcurrentMap<T> map_;
+    std::default_random_engine er;
+};
+
+using TypeOfPks = testing::Types<int64_t, std::string>;
+TYPED_TEST_SUITE_P(TypedOffsetConcurrentMapTest);
+
+TYPED_TEST_P(TypedOffsetConcurrentMapTest, find_first) {
+    // no data.
+    {
+        auto [offsets, has_more_res] = this->map_.find_first(Unlimited, {});
+        ASSERT_EQ(0, offsets.size());
+        ASSERT_FALSE(has_more_res);
+    }
+    // insert 10 entities.
+    int num = 10;
+    auto data = this->random_generate(num);
+    for (const auto& x : data) {
+        this->insert(x);
+    }
+
+    // all is satisfied.
+    BitsetType all(num);
+    all.reset();
+
+    {
+        auto [offsets, has_more_res] = this->map_.find_first(num / 2, all);
+        ASSERT_EQ(num / 2, offsets.size());
+        ASSERT_TRUE(has_more_res);
+        for (int i = 1; i < offsets.size(); i++) {
+            ASSERT_TRUE(data[offsets[i - 1]] <= data[offsets[i]]);
+        }
+    }
+    {
+        auto [offsets, has_more_res] = this->map_.find_first(Unlimited, all);
+        ASSERT_EQ(num, offsets.size());
+        ASSERT_FALSE(has_more_res);
+        for (int i = 1; i < offsets.size(); i++) {
+            ASSERT_TRUE(data[offsets[i - 1]] <= data[offsets[i]]);
+        }
+    }
+
+    // corner case, segment offset exceeds the size of bitset.
+    BitsetType all_minus_1(num - 1);
+    all_minus_1.reset();
+    {
+        auto [offsets, has_more_res] =
+            this->map_.find_first(num / 2, all_minus_1);
+        ASSERT_EQ(num / 2, offsets.size());
+        ASSERT_TRUE(has_more_res);
+        for (int i = 1; i < offsets.size(); i++) {
+            ASSERT_TRUE(data[offsets[i - 1]] <= data[offsets[i]]);
+        }
+    }
+    {
+        auto [offsets, has_more_res] =
+            this->map_.find_first(Unlimited, all_minus_1);
+        ASSERT_EQ(all_minus_1.size(), offsets.size());
+        ASSERT_FALSE(has_more_res);
+        for (int i = 1; i < offsets.size(); i++) {
+            ASSERT_TRUE(data[offsets[i - 1]] <= data[offsets[i]]);
+        }
+    }
+
+    // none is satisfied.
+    BitsetType none(num);
+    none.set();
+    {
+        auto [offsets, has_more_res] = this->map_.find_first(num / 2, none);
+        ASSERT_TRUE(has_more_res);
+        ASSERT_EQ(0, offsets.size());
+    }
+    {
+        auto [offsets, has_more_res] = this->map_.find_first(NoLimit, none);
+        ASSERT_TRUE(has_more_res);
+        ASSERT_EQ(0, offsets.size());
+    }
+}
+
+TYPED_TEST_P(TypedOffsetConcurrentMapTest, concurrent_insert) {
+    // every thread inserts the same pks at its own offsets, so each pk ends
+    // up with one offset per thread.
+    int num_threads = 4;
+    int num = 5000;
+    auto data = this->random_generate(num);
+    std::sort(data.begin(), data.end());
+    data.erase(std::unique(data.begin(), data.end()), data.end());
+    num = data.size();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < num; i++) {
+                this->map_.insert(data[i], int64_t(i) * num_threads + t);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < num; i++) {
+        ASSERT_TRUE(this->map_.contain(data[i]));
+        auto offsets = this->map_.find(data[i]);
+        ASSERT_EQ(num_threads, offsets.size());
+        for (int t = 0; t < num_threads; t++) {
+            ASSERT_EQ(int64_t(i) * num_threads + t, offsets[t]);
+        }
+    }
+
+    // find_first returns every pk once, ordered, with its latest offset.
+    BitsetType all(num * num_threads);
+    all.reset();
+    auto [offsets, has_more_res] = this->map_.find_first(Unlimited, all);
+    ASSERT_FALSE(has_more_res);
+    ASSERT_EQ(num, offsets.size());
+    for (int i = 0; i < num; i++) {
+        ASSERT_EQ(int64_t(i) * num_threads + num_threads - 1, offsets[i]);
+    }
+
+    // the latest offset is filtered, the one before it is picked.
+    for (int i = 0; i < num; i++) {
+        all.set(int64_t(i) * num_threads + num_threads - 1);
+    }
+    std::tie(offsets, has_more_res) = this->map_.find_first(num / 2, all);
+    ASSERT_TRUE(has_more_res);
+    ASSERT_EQ(num / 2, offsets.size());
+    for (int i = 0; i < num / 2; i++) {
+        ASSERT_EQ(int64_t(i) * num_threads + num_threads - 2, offsets[i]);
+    }
+}
+
+TYPED_TEST_P(TypedOffsetConcurrentMapTest, concurrent_insert_find_first) {
+    // a pk is returned by find_first as soon as its insert returned, even
+    // while other writers keep inserting.
+    int num_threads = 4;
+    int num = 20000;
+    auto data = this->random_generate(num);
+    std::sort(data.begin(), data.end());
+    data.erase(std::unique(data.begin(), data.end()), data.end());
+    num = data.size() / num_threads * num_threads;
+
+    std::atomic<int> missed{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t]() {
+            BitsetType all(num);
+            all.reset();
+            for (int i = t; i < num; i += num_threads) {
+                this->map_.insert(data[i], i);
+                if ((i / num_threads) % 64 != 0) {
+                    continue;
+                }
+                auto [offsets, has_more_res] =
+                    this->map_.find_first(Unlimited, all);
+                if (std::find(offsets.begin(), offsets.end(), i) ==
+                    offsets.end()) {
+                    missed++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(0, missed.load());
+
+    BitsetType all(num);
+    all.reset();
+    auto [offsets, has_more_res] = this->map_.find_first(Unlimited, all);
+    ASSERT_FALSE(has_more_res);
+    ASSERT_EQ(num, offsets.size());
+    for (int i = 0; i < num; i++) {
+        ASSERT_EQ(i, offsets[i]);
+    }
+
+    // every entry is held once, by its skip list node
+    ASSERT_GE(this->map_.mem_size(),
+              int64_t(num) * sizeof(std::pair<TypeParam, int64_t>));
+    this->map_.clear();
+    ASSERT_EQ(0, this->map_.mem_size());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TypedOffsetConcurrentMapTest,
+                            find_first,
+                            concurrent_insert,
+                            concurrent_insert_find_first);
+INSTANTIATE_TYPED_TEST_SUITE_P(Prefix, TypedOffsetConcurrentMapTest, TypeOfPks);
@@ -133,3 +133,78 @@ TEST(Reduce, SubSearchResult) {
     TestSubSearchResultMerge<queue_type_ip>(knowhere::metric::IP, 4, 16, 1);
     TestSubSearchResultMerge<queue_type_ip>(knowhere::metric::IP, 4, 16, 10);
 }
+
+template <class queue_type>
+void
+TestSubSearchResultMergeAll(const knowhere::MetricType& metric_type,
+                            const int64_t iteration,
+                            const int64_t nq,
+                            const int64_t topk) {
+    const int64_t round_decimal = 3;
+
+    std::vector<queue_type> result_ref(nq);
+    std::vector<SubSearchResultUniq> sub_results;
+    std::vector<const SubSearchResult*> others;
+
+    SubSearchResult pairwise_result(nq, topk, metric_type, round_decimal);
+    for (int i = 0; i < iteration; ++i) {
+        sub_results.emplace_back(
+            GenSubSearchResult(nq, topk, metric_type, round_decimal));
+        auto ids = sub_results.back()->get_ids();
+        for (int n = 0; n < nq; ++n) {
+            for (int k = 0; k < topk; ++k) {
+                result_ref[n].push(ids[n * topk + k]);
+                if (result_ref[n].size() > topk) {
+                    result_ref[n].pop();
+                }
+            }
+        }
+        pairwise_result.merge(*sub_results.back());
+        others.push_back(sub_results.back().get());
+    }
+
+    SubSearchResult final_result(nq, topk, metric_type, round_decimal);
+    final_result.merge(others);
+    ASSERT_EQ(final_result.mutable_seg_offsets(),
+              pairwise_result.mutable_seg_offsets());
+    ASSERT_EQ(final_result.mutable_distances(),
+              pairwise_result.mutable_distances());
+    CheckSubSearchResult<queue_type>(nq, topk, final_result, result_ref);
+}
+
+TEST(Reduce, SubSearchResultMergeAll) {
+    using queue_type_l2 =
+        std::priority_queue<int64_t, std::vector<int64_t>, std::less<int64_t>>;
+    using queue_type_ip = std::
+        priority_queue<int64_t, std::vector<int64_t>, std::greater<int64_t>>;
+
+    TestSubSearchResultMergeAll<queue_type_l2>(knowhere::metric::L2, 1, 16, 1);
+    TestSubSearchResultMergeAll<queue_type_l2>(knowhere::metric::L2, 4, 16, 1);
+    TestSubSearchResultMergeAll<queue_type_l2>(knowhere::metric::L2, 4, 16, 10);
+    TestSubSearchResultMergeAll<queue_type_l2>(knowhere::metric::L2, 33, 16, 10);
+
+    TestSubSearchResultMergeAll<queue_type_ip>(knowhere::metric::IP, 1, 16, 1);
+    TestSubSearchResultMergeAll<queue_type_ip>(knowhere::metric::IP, 4, 16, 1);
+    TestSubSearchResultMergeAll<queue_type_ip>(knowhere::metric::IP, 4, 16, 10);
+    TestSubSearchResultMergeAll<queue_type_ip>(knowhere::metric::IP, 33, 16, 10);
+}
+
+TEST(Reduce, SubSearchResultMergeAllInvalid) {
+    const int64_t nq = 2;
+    const int64_t topk = 3;
+    SubSearchResult left(nq, topk, knowhere::metric::L2, -1);
+    SubSearchResult right(nq, topk, knowhere::metric::L2, -1);
+    // query 0: left has one hit, right has two; query 1 has none at all
+    left.mutable_seg_offsets()[0] = 7;
+    left.mutable_distances()[0] = 2.0;
+    right.mutable_seg_offsets()[0] = 8;
+    right.mutable_distances()[0] = 1.0;
+    right.mutable_seg_offsets()[1] = 9;
+    right.mutable_distances()[1] = 3.0;
+
+    left.merge(std::vector<const SubSearchResult*>{&right});
+    std::vector<int64_t> expected_ids{
+        8, 7, 9, INVALID_SEG_OFFSET, INVALID_SEG_OFFSET, INVALID_SEG_OFFSET};
+    ASSERT_EQ(left.mutable_seg_offsets(), expected_ids);
+    ASSERT_EQ(left.get_distances()[2], 3.0);
+}
@@ -226,6 +226,52 @@ TYPED_TEST_P(TypedScalarIndexTest, Codec) {
     }
 }
 
+TYPED_TEST_P(TypedScalarIndexTest, CountWithoutBitset) {
+    using T = TypeParam;
+    auto dtype = milvus::GetDType<T>();
+    auto index_types = GetIndexTypes<T>();
+    for (const auto& index_type : index_types) {
+        milvus::index::CreateIndexInfo create_index_info;
+        create_index_info.field_type = milvus::DataType(dtype);
+        create_index_info.index_type = index_type;
+        auto index =
+            milvus::index::IndexFactory::GetInstance().CreateScalarIndex(
+                create_index_info, GetTempFileManagerCtx(dtype));
+        auto scalar_index =
+            dynamic_cast<milvus::index::ScalarIndex<T>*>(index.get());
+        auto arr = GenSortedArr<T>(nb);
+        scalar_index->Build(nb, arr.data());
+
+        std::vector<int64_t> excluded{0, 3, nb / 2, nb - 1};
+        auto expected_count = [&](const milvus::TargetBitmap& bitset) {
+            int64_t cnt = bitset.count();
+            for (auto offset : excluded) {
+                cnt -= bitset[offset];
+            }
+            return cnt;
+        };
+
+        auto value = arr[nb / 2];
+        for (auto op : {milvus::OpType::GreaterThan,
+                        milvus::OpType::GreaterEqual,
+                        milvus::OpType::LessThan,
+                        milvus::OpType::LessEqual}) {
+            auto cnt = scalar_index->CountRange(value, op, excluded);
+            ASSERT_TRUE(cnt.has_value());
+            ASSERT_EQ(cnt.value(),
+                      expected_count(scalar_index->Range(value, op)));
+        }
+
+        std::vector<T> values{arr[1], arr[3], arr[nb - 1], arr[3]};
+        auto cnt =
+            scalar_index->CountIn(values.size(), values.data(), excluded);
+        ASSERT_TRUE(cnt.has_value());
+        ASSERT_EQ(cnt.value(),
+                  expected_count(
+                      scalar_index->In(values.size(), values.data())));
+    }
+}
+
 // TODO: it's easy to overflow for int8_t. Design more reasonable ut.
 using ScalarT =
     ::testing::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
@@ -239,7 +285,8 @@ REGISTER_TYPED_TEST_SUITE_P(TypedScalarIndexTest,
                             Range,
                             Codec,
                             Reverse,
-                            HasRawData);
+                            HasRawData,
+                            CountWithoutBitset);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(ArithmeticCheck, TypedScalarIndexTest, ScalarT);
 
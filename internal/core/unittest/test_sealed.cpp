@@ -16,6 +16,7 @@
 #include "common/Tracer.h"
 #include "index/IndexFactory.h"
 #include "knowhere/version.h"
+#include "query/CountPushdown.h"
 #include "segcore/SegmentSealedImpl.h"
 #include "storage/MmapManager.h"
 #include "storage/MinioChunkManager.h"
@@ -799,6 +800,157 @@ TEST(Sealed, LoadFieldDataMmap) {
     ASSERT_ANY_THROW(segment->Search(plan.get(), ph_group.get(), timestamp));
 }
 
+TEST(Sealed, LoadFieldDataInPlace) {
+    auto dim = 16;
+    auto metric_type = knowhere::metric::L2;
+    auto schema = std::make_shared<Schema>();
+    auto fakevec_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, metric_type);
+    auto counter_id = schema->AddDebugField("counter", DataType::INT64);
+    auto bool_id = schema->AddDebugField("bool", DataType::BOOL);
+    auto int8_id = schema->AddDebugField("int8", DataType::INT8);
+    auto double_id = schema->AddDebugField("double", DataType::DOUBLE);
+    auto int32_nullable_id =
+        schema->AddDebugField("int32_null", DataType::INT32, true);
+    schema->set_primary_field_id(counter_id);
+
+    // every field is written into two binlogs, listed out of log id order
+    int64_t N1 = 3000;
+    int64_t N2 = 1234;
+    auto dataset1 = DataGen(schema, N1, 42);
+    auto dataset2 = DataGen(schema, N2, 43);
+
+    auto storage_config = get_default_local_storage_config();
+    auto cm = storage::CreateChunkManager(storage_config);
+    auto prefix = storage_config.root_path + "/test_load_in_place";
+    LoadFieldDataInfo load_info;
+    for (auto& [field_id, field_meta] : schema->get_fields()) {
+        std::vector<std::string> files;
+        std::vector<int64_t> entries_nums;
+        for (auto [log_id, dataset, rows] :
+             {std::make_tuple(2, &dataset2, N2),
+              std::make_tuple(1, &dataset1, N1)}) {
+            auto field_data = CreateFieldDataFromDataArray(
+                rows, dataset->get_col(field_id).get(), field_meta);
+            auto insert_data = std::make_shared<InsertData>(field_data);
+            FieldDataMeta field_data_meta{1, 2, 3, field_id.get()};
+            insert_data->SetFieldDataMeta(field_data_meta);
+            auto serialized = insert_data->serialize_to_remote_file();
+            auto file = prefix + "/" + std::to_string(field_id.get()) + "/" +
+                         std::to_string(log_id);
+            cm->Write(file, serialized.data(), serialized.size());
+            files.push_back(file);
+            entries_nums.push_back(rows);
+        }
+        load_info.field_infos.emplace(
+            field_id.get(),
+            FieldBinlogInfo{
+                field_id.get(), N1 + N2, entries_nums, false, files});
+    }
+
+    auto segment = CreateSealedSegment(schema);
+    segment->LoadFieldData(load_info);
+
+    auto check = [&](FieldId field_id, auto type_tag, int64_t width) {
+        using T = decltype(type_tag);
+        auto span = segment->chunk_data<T>(field_id, 0);
+        auto ref1 = dataset1.get_col<T>(field_id);
+        auto ref2 = dataset2.get_col<T>(field_id);
+        for (int64_t i = 0; i < N1 * width; ++i) {
+            ASSERT_EQ(span.data()[i], ref1[i]);
+        }
+        for (int64_t i = 0; i < N2 * width; ++i) {
+            ASSERT_EQ(span.data()[N1 * width + i], ref2[i]);
+        }
+    };
+    check(fakevec_id, float{}, dim);
+    check(counter_id, int64_t{}, 1);
+    check(bool_id, bool{}, 1);
+    check(int8_id, int8_t{}, 1);
+    check(double_id, double{}, 1);
+    check(int32_nullable_id, int32_t{}, 1);
+
+    auto span = segment->chunk_data<int32_t>(int32_nullable_id, 0);
+    auto valid1 = dataset1.get_col_valid(int32_nullable_id);
+    auto valid2 = dataset2.get_col_valid(int32_nullable_id);
+    for (int64_t i = 0; i < N1; ++i) {
+        ASSERT_EQ(span.valid_data()[i], valid1[i]);
+    }
+    for (int64_t i = 0; i < N2; ++i) {
+        ASSERT_EQ(span.valid_data()[N1 + i], valid2[i]);
+    }
+    ASSERT_EQ(segment->get_row_count(), N1 + N2);
+
+    for (auto& [field_id, info] : load_info.field_infos) {
+        for (auto& file : info.insert_files) {
+            cm->Remove(file);
+        }
+    }
+}
+
+TEST(Sealed, LoadFieldDataAllFields) {
+    auto dim = 16;
+    auto N = ROW_COUNT;
+    auto schema = std::make_shared<Schema>();
+    auto fakevec_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto counter_id = schema->AddDebugField("counter", DataType::INT64);
+    auto str_id = schema->AddDebugField("str", DataType::VARCHAR);
+    auto json_id = schema->AddDebugField("json", DataType::JSON);
+    std::vector<FieldId> scalar_ids;
+    for (int i = 0; i < 8; ++i) {
+        scalar_ids.push_back(schema->AddDebugField(
+            "double_" + std::to_string(i), DataType::DOUBLE));
+    }
+    schema->set_primary_field_id(counter_id);
+    auto dataset = DataGen(schema, N);
+
+    // system fields, the pk and every scalar field are loaded in one call
+    auto storage_config = get_default_local_storage_config();
+    auto cm = storage::CreateChunkManager(storage_config);
+    auto load_info =
+        PrepareInsertBinlog(1,
+                            2,
+                            3,
+                            storage_config.root_path + "/test_load_all_fields",
+                            dataset,
+                            cm);
+    auto segment = CreateSealedSegment(schema);
+    segment->LoadFieldData(load_info);
+
+    auto sealed = dynamic_cast<SegmentSealedImpl*>(segment.get());
+    ASSERT_EQ(segment->get_row_count(), N);
+    ASSERT_TRUE(sealed->is_system_field_ready());
+    for (auto& [field_id, field_meta] : schema->get_fields()) {
+        ASSERT_TRUE(segment->HasFieldData(field_id));
+    }
+
+    auto pks = dataset.get_col<int64_t>(counter_id);
+    auto pk_span = segment->chunk_data<int64_t>(counter_id, 0);
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(pk_span.data()[i], pks[i]);
+    }
+    for (auto field_id : scalar_ids) {
+        auto ref = dataset.get_col<double>(field_id);
+        auto span = segment->chunk_data<double>(field_id, 0);
+        for (int64_t i = 0; i < N; ++i) {
+            ASSERT_EQ(span.data()[i], ref[i]);
+        }
+    }
+    auto strs = dataset.get_col(str_id)->scalars().string_data().data();
+    auto views = segment->get_batch_views<std::string_view>(str_id, 0, 0, N);
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(views.first[i], strs[i]);
+    }
+
+    // the pk index is built as part of the concurrent load
+    auto pk_offsets = sealed->search_pk(pks[N / 2], MAX_TIMESTAMP);
+    ASSERT_TRUE(std::any_of(
+        pk_offsets.begin(), pk_offsets.end(), [&](SegOffset offset) {
+            return offset.get() == N / 2;
+        }));
+}
+
 TEST(Sealed, LoadPkScalarIndex) {
     size_t N = ROW_COUNT;
     auto schema = std::make_shared<Schema>();
@@ -1142,6 +1294,71 @@ TEST(Sealed, OverlapDelete) {
         << std::endl;
 }
 
+TEST(Sealed, DeleteSortedVarcharPk) {
+    int64_t N = 1000;
+    auto schema = std::make_shared<Schema>();
+    auto pk_id = schema->AddDebugField("pk", DataType::VARCHAR);
+    schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(pk_id);
+
+    // every pk appears twice, sort the pk column to mimic a sorted segment
+    auto dataset = DataGen(schema, N, 42, 0, 2);
+    std::vector<std::string> pks;
+    for (auto& field_data : *dataset.raw_->mutable_fields_data()) {
+        if (field_data.field_id() == pk_id.get()) {
+            auto data = field_data.mutable_scalars()->mutable_string_data();
+            std::sort(data->mutable_data()->begin(),
+                      data->mutable_data()->end());
+            pks.assign(data->data().begin(), data->data().end());
+        }
+    }
+    ASSERT_EQ(pks.size(), N);
+
+    std::vector<std::string> deleted_pks{pks[0], pks[10], pks[N - 1]};
+    int64_t expected = 0;
+    for (auto& pk : pks) {
+        expected += std::count(deleted_pks.begin(), deleted_pks.end(), pk);
+    }
+
+    auto& config = SegcoreConfig::default_config();
+    for (bool enable_hash_index : {false, true}) {
+        config.set_enable_varchar_pk_hash_index(enable_hash_index);
+        auto segment =
+            CreateSealedSegment(schema, nullptr, -1, config, false, true);
+        SealedLoadFieldData(dataset, *segment);
+
+        auto ids = std::make_unique<IdArray>();
+        ids->mutable_str_id()->mutable_data()->Add(deleted_pks.begin(),
+                                                   deleted_pks.end());
+        std::vector<Timestamp> timestamps(deleted_pks.size(), N + 1);
+        LoadDeletedRecordInfo info = {
+            timestamps.data(), ids.get(), int64_t(deleted_pks.size())};
+        segment->LoadDeletedRecord(info);
+
+        // deletes are not visible yet
+        BitsetType bitset(N, false);
+        segment->mask_with_delete(bitset, N, N);
+        ASSERT_EQ(bitset.count(), 0);
+
+        bitset.reset();
+        segment->mask_with_delete(bitset, N, N + 2);
+        ASSERT_EQ(bitset.count(), expected);
+        ASSERT_TRUE(bitset[0]);
+        ASSERT_TRUE(bitset[N - 1]);
+
+        // rows beyond the insert barrier are never masked
+        int64_t expected_partial = 0;
+        for (int64_t i = 0; i < N / 2; ++i) {
+            expected_partial += std::count(
+                deleted_pks.begin(), deleted_pks.end(), pks[i]);
+        }
+        BitsetType partial(N / 2, false);
+        segment->mask_with_delete(partial, N / 2, N + 2);
+        ASSERT_EQ(partial.count(), expected_partial);
+    }
+    config.set_enable_varchar_pk_hash_index(false);
+}
+
 auto
 GenMaxFloatVecs(int N, int dim) {
     std::vector<float> vecs;
@@ -1286,6 +1503,132 @@ TEST(Sealed, BF_Overflow) {
     }
 }
 
+TEST(Sealed, ActiveRangeByTimestamp) {
+    auto schema = std::make_shared<Schema>();
+    auto dim = 16;
+    auto metric_type = "L2";
+    auto fake_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, metric_type);
+    auto i64_fid = schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+
+    // timestamps are 0..N-1, sliced into [0, 4096), [4096, 8192), [8192, N)
+    int64_t N = 10000;
+    auto dataset = DataGen(schema, N);
+    auto segment = CreateSealedSegment(schema);
+    SealedLoadFieldData(dataset, *segment);
+
+    Timestamp ts = 5000;
+    ASSERT_EQ(segment->get_active_count(MAX_TIMESTAMP), N);
+    ASSERT_EQ(segment->get_active_count(ts), 8192);
+
+    // brute force search only sees rows not newer than ts
+    auto topK = 100;
+    auto fmt = boost::format(R"(vector_anns: <
+                                            field_id: 100
+                                            query_info: <
+                                                topk: %1%
+                                                metric_type: "L2"
+                                                search_params: "{\"nprobe\": 10}"
+                                            >
+                                            placeholder_tag: "$0">
+                                            output_field_ids: 101)") %
+               topK;
+    auto serialized_expr_plan = fmt.str();
+    auto binary_plan =
+        translate_text_plan_to_binary_plan(serialized_expr_plan.data());
+    auto plan =
+        CreateSearchPlanByExpr(*schema, binary_plan.data(), binary_plan.size());
+    auto num_queries = 5;
+    auto ph_group_raw = CreatePlaceholderGroup(num_queries, dim, 1024);
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+    auto result = segment->Search(plan.get(), ph_group.get(), ts);
+    ASSERT_EQ(result->seg_offsets_.size(), num_queries * topK);
+    for (auto offset : result->seg_offsets_) {
+        ASSERT_NE(offset, INVALID_SEG_OFFSET);
+        ASSERT_LE(dataset.timestamps_[offset], ts);
+    }
+
+    // count(*) at ts covers the visible prefix and the checked rows only
+    auto retrieve_plan = std::make_unique<query::RetrievePlan>(*schema);
+    retrieve_plan->plan_node_ = std::make_unique<query::RetrievePlanNode>();
+    retrieve_plan->plan_node_->is_count_ = true;
+    std::vector<std::pair<Timestamp, int64_t>> expected_counts{
+        {ts, int64_t(ts) + 1}, {MAX_TIMESTAMP, N}, {0, 1}};
+    for (auto [query_ts, expected] : expected_counts) {
+        auto retrieve_result = segment->Retrieve(nullptr,
+                                                 retrieve_plan.get(),
+                                                 query_ts,
+                                                 DEFAULT_MAX_OUTPUT_SIZE,
+                                                 false);
+        ASSERT_EQ(retrieve_result->fields_data_size(), 1);
+        auto& count_data = retrieve_result->fields_data(0).scalars();
+        ASSERT_EQ(count_data.long_data().data(0), expected);
+        // the same as the bitset path reports, whatever the active count
+        ASSERT_EQ(retrieve_result->all_retrieve_count(), N);
+    }
+
+    // nothing is active before the first insert, the retrieve result still
+    // reports every row of the segment
+    auto late_dataset = DataGen(schema, N, 42, 100);
+    auto late_segment = CreateSealedSegment(schema);
+    SealedLoadFieldData(late_dataset, *late_segment);
+    ASSERT_EQ(late_segment->get_active_count(50), 0);
+    for (bool is_count : {false, true}) {
+        retrieve_plan->plan_node_->is_count_ = is_count;
+        auto retrieve_result = late_segment->Retrieve(nullptr,
+                                                      retrieve_plan.get(),
+                                                      50,
+                                                      DEFAULT_MAX_OUTPUT_SIZE,
+                                                      false);
+        ASSERT_EQ(retrieve_result->all_retrieve_count(), N);
+    }
+
+    // deletes between the insert slices, pk i is inserted at ts i. The
+    // cached delete bitmaps are sized to the active count and reused
+    // between timestamps with different active counts.
+    std::map<int64_t, Timestamp> deletes{
+        {100, 2000}, {4500, 4800}, {5000, 6000}, {7000, 7500}, {9000, 9500}};
+    auto ids = std::make_unique<IdArray>();
+    std::vector<Timestamp> delete_timestamps;
+    for (auto [pk, delete_ts] : deletes) {
+        ids->mutable_int_id()->add_data(pk);
+        delete_timestamps.push_back(delete_ts);
+    }
+    LoadDeletedRecordInfo info = {
+        delete_timestamps.data(), ids.get(), int64_t(deletes.size())};
+    segment->LoadDeletedRecord(info);
+
+    auto masked = [&](int64_t i, Timestamp query_ts) {
+        auto it = deletes.find(i);
+        return dataset.timestamps_[i] > query_ts ||
+               (it != deletes.end() && it->second <= query_ts);
+    };
+    for (Timestamp query_ts : {ts, MAX_TIMESTAMP, ts, Timestamp(6500)}) {
+        auto active_count = segment->get_active_count(query_ts);
+        BitsetType bitset(active_count);
+        segment->mask_with_delete(bitset, active_count, query_ts);
+        segment->mask_with_timestamps(bitset, query_ts);
+        ASSERT_EQ(bitset.size(), N);
+        int64_t expected = 0;
+        for (int64_t i = 0; i < N; ++i) {
+            ASSERT_EQ(bitset[i], masked(i, query_ts))
+                << "row " << i << ", ts " << query_ts;
+            expected += !masked(i, query_ts);
+        }
+
+        auto retrieve_result = segment->Retrieve(nullptr,
+                                                 retrieve_plan.get(),
+                                                 query_ts,
+                                                 DEFAULT_MAX_OUTPUT_SIZE,
+                                                 false);
+        auto& count_data = retrieve_result->fields_data(0).scalars();
+        ASSERT_EQ(count_data.long_data().data(0), expected)
+            << "ts " << query_ts;
+    }
+}
+
 TEST(Sealed, DeleteCount) {
     {
         auto schema = std::make_shared<Schema>();
@@ -2475,3 +2818,90 @@ TEST(Sealed, QueryAllNullableFields) {
     EXPECT_EQ(double_array_result->valid_data_size(), dataset_size);
     EXPECT_EQ(float_array_result->valid_data_size(), dataset_size);
 }
+
+TEST(Sealed, CountWithoutBitset) {
+    auto schema = std::make_shared<Schema>();
+    auto pk_id = schema->AddDebugField("pk", DataType::INT64);
+    auto age_id = schema->AddDebugField("age", DataType::INT32);
+    schema->set_primary_field_id(pk_id);
+
+    // pk and insert timestamp of row i are both i
+    int64_t N = 1000;
+    auto dataset = DataGen(schema, N);
+    auto segment = CreateSealedSegment(schema);
+    SealedLoadFieldData(dataset, *segment);
+    auto ages = dataset.get_col<int32_t>(age_id);
+
+    LoadIndexInfo age_index;
+    age_index.field_id = age_id.get();
+    age_index.field_type = DataType::INT32;
+    age_index.index_params["index_type"] = "sort";
+    age_index.index = GenScalarIndexing<int32_t>(N, ages.data());
+    segment->LoadIndex(age_index);
+
+    std::map<int64_t, Timestamp> deletes{
+        {1, 200}, {10, 200}, {100, 200}, {150, 800}, {500, 600}};
+    auto ids = std::make_unique<IdArray>();
+    std::vector<Timestamp> delete_timestamps;
+    for (auto [pk, ts] : deletes) {
+        ids->mutable_int_id()->add_data(pk);
+        delete_timestamps.push_back(ts);
+    }
+    LoadDeletedRecordInfo info = {
+        delete_timestamps.data(), ids.get(), int64_t(deletes.size())};
+    segment->LoadDeletedRecord(info);
+
+    auto visible = [&](int64_t i, Timestamp ts) {
+        auto it = deletes.find(i);
+        return Timestamp(i) <= ts && (it == deletes.end() || it->second > ts);
+    };
+    auto expected_count = [&](Timestamp ts, auto&& matches) {
+        int64_t cnt = 0;
+        for (int64_t i = 0; i < N; ++i) {
+            cnt += visible(i, ts) && matches(ages[i]);
+        }
+        return cnt;
+    };
+
+    auto pivot = ages[N / 2];
+    proto::plan::GenericValue pivot_value;
+    pivot_value.set_int64_val(pivot);
+    auto range_expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(age_id, DataType::INT32),
+        proto::plan::OpType::GreaterEqual,
+        pivot_value);
+    std::vector<proto::plan::GenericValue> term_values;
+    for (auto i : {0, 10, 150, 500, 700}) {
+        proto::plan::GenericValue value;
+        value.set_int64_val(ages[i]);
+        term_values.push_back(value);
+    }
+    auto term_expr = std::make_shared<expr::TermFilterExpr>(
+        expr::ColumnInfo(age_id, DataType::INT32), term_values);
+    auto in_terms = [&](int32_t age) {
+        return std::any_of(
+            term_values.begin(), term_values.end(), [&](const auto& value) {
+                return value.int64_val() == age;
+            });
+    };
+
+    // before, between and after the deletes, and with rows inserted after
+    // the timestamp
+    for (Timestamp ts : {50, 199, 200, 300, 700, 900, 5000}) {
+        auto cnt = TryCountWithoutBitset(*segment, nullptr, N, ts);
+        ASSERT_TRUE(cnt.has_value());
+        ASSERT_EQ(cnt.value(), expected_count(ts, [](int32_t) {
+                      return true;
+                  })) << "ts: " << ts;
+
+        cnt = TryCountWithoutBitset(*segment, range_expr, N, ts);
+        ASSERT_TRUE(cnt.has_value());
+        ASSERT_EQ(cnt.value(), expected_count(ts, [&](int32_t age) {
+                      return age >= pivot;
+                  })) << "ts: " << ts;
+
+        cnt = TryCountWithoutBitset(*segment, term_expr, N, ts);
+        ASSERT_TRUE(cnt.has_value());
+        ASSERT_EQ(cnt.value(), expected_count(ts, in_terms)) << "ts: " << ts;
+    }
+}
@@ -119,6 +119,56 @@ TEST_F(StringIndexMarisaTest, Range) {
     }
 }
 
+TEST_F(StringIndexMarisaTest, RangeMatchesScan) {
+    std::vector<std::string> strings(nb);
+    for (int i = 0; i < nb; ++i) {
+        // keys sharing prefixes, in an order the trie doesn't enumerate
+        strings[i] = std::to_string(std::rand() % 1000);
+    }
+    auto index = milvus::index::CreateStringIndexMarisa();
+    index->Build(nb, strings.data());
+
+    auto copy_index = milvus::index::CreateStringIndexMarisa();
+    {
+        auto binary_set = index->Serialize(nullptr);
+        copy_index->Load(binary_set);
+    }
+
+    std::vector<std::string> bounds = {"", "1", "10", "5", "55", "999", "a"};
+    for (auto& idx : {index.get(), copy_index.get()}) {
+        for (auto& bound : bounds) {
+            auto gt = idx->Range(bound, milvus::OpType::GreaterThan);
+            auto ge = idx->Range(bound, milvus::OpType::GreaterEqual);
+            auto lt = idx->Range(bound, milvus::OpType::LessThan);
+            auto le = idx->Range(bound, milvus::OpType::LessEqual);
+            for (int i = 0; i < nb; ++i) {
+                ASSERT_EQ(gt[i], strings[i] > bound);
+                ASSERT_EQ(ge[i], strings[i] >= bound);
+                ASSERT_EQ(lt[i], strings[i] < bound);
+                ASSERT_EQ(le[i], strings[i] <= bound);
+            }
+        }
+
+        for (auto& lower : bounds) {
+            for (auto& upper : bounds) {
+                for (bool lb_inclusive : {true, false}) {
+                    for (bool ub_inclusive : {true, false}) {
+                        auto bitset = idx->Range(
+                            lower, lb_inclusive, upper, ub_inclusive);
+                        for (int i = 0; i < nb; ++i) {
+                            auto& s = strings[i];
+                            bool expected =
+                                (lb_inclusive ? s >= lower : s > lower) &&
+                                (ub_inclusive ? s <= upper : s < upper);
+                            ASSERT_EQ(bitset[i], expected);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
 TEST_F(StringIndexMarisaTest, Reverse) {
     auto index_types = GetIndexTypes<std::string>();
     for (const auto& index_type : index_types) {
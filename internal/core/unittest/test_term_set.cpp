@@ -0,0 +1,100 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <set>
+#include "exec/expression/TermSet.h"
+
+using namespace milvus;
+using milvus::exec::TermSet;
+
+template <typename T>
+class TypedTermSetTest : public testing::Test {
+ public:
+    void
+    SetUp() override {
+        er = std::default_random_engine(42);
+    }
+
+ protected:
+    // `num` values drawn from [-spread / 2, spread / 2)
+    std::vector<T>
+    random_generate(int num, int64_t spread) {
+        std::vector<T> res;
+        for (int i = 0; i < num; i++) {
+            auto v = static_cast<int64_t>(er() % spread) - spread / 2;
+            res.push_back(static_cast<T>(v));
+        }
+        return res;
+    }
+
+    void
+    check(const std::vector<T>& values, const std::vector<T>& probes) {
+        std::set<T> expected(values.begin(), values.end());
+        TermSet<T> term_set(values);
+        TargetBitmap res(probes.size());
+        term_set.BatchContains(probes.data(), probes.size(), res);
+        for (size_t i = 0; i < probes.size(); i++) {
+            auto found = expected.find(probes[i]) != expected.end();
+            ASSERT_EQ(term_set.Contains(probes[i]), found) << i;
+            ASSERT_EQ(res[i], found) << i;
+        }
+    }
+
+ protected:
+    std::default_random_engine er;
+};
+
+using TypeOfTermSet = testing::Types<int8_t, int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE_P(TypedTermSetTest);
+
+TYPED_TEST_P(TypedTermSetTest, contains) {
+    using T = TypeParam;
+    // linear, bitmap, sorted and hash layouts
+    for (int num : {0, 1, 16, 17, 256, 257, 5000}) {
+        for (int64_t spread : {int64_t(100), int64_t(1) << 40}) {
+            auto values = this->random_generate(num, spread);
+            auto probes = this->random_generate(4096, spread);
+            probes.insert(probes.end(), values.begin(), values.end());
+            probes.push_back(std::numeric_limits<T>::lowest());
+            probes.push_back(std::numeric_limits<T>::max());
+            this->check(values, probes);
+        }
+    }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TypedTermSetTest, contains);
+INSTANTIATE_TYPED_TEST_SUITE_P(Prefix, TypedTermSetTest, TypeOfTermSet);
+
+TEST(TermSet, NaN) {
+    TermSet<double> term_set({1.0, NAN, 2.0});
+    ASSERT_EQ(term_set.size(), 2);
+    ASSERT_FALSE(term_set.Contains(NAN));
+    ASSERT_TRUE(term_set.Contains(2.0));
+}
+
+TEST(TermSet, String) {
+    for (int num : {0, 1, 16, 17, 1000}) {
+        std::vector<std::string> values;
+        for (int i = 0; i < num; i++) {
+            values.push_back("term_set_value_" + std::to_string(i * 7));
+        }
+        TermSet<std::string> term_set(values);
+        for (int i = 0; i < 8000; i++) {
+            auto probe = "term_set_value_" + std::to_string(i);
+            auto found = i % 7 == 0 && i / 7 < num;
+            ASSERT_EQ(term_set.Contains(probe), found) << probe;
+        }
+    }
+}
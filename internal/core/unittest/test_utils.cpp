@@ -9,9 +9,12 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <cstring>
+#include <numeric>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <string.h>
@@ -24,9 +27,14 @@
 #include "common/Utils.h"
 #include "common/Exception.h"
 #include "knowhere/sparse_utils.h"
+#include "monitor/prometheus_client.h"
 #include "pb/schema.pb.h"
 #include "query/Utils.h"
+#include "segcore/Utils.h"
+#include "storage/InsertData.h"
+#include "storage/Util.h"
 #include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
 
 TEST(Util, StringMatch) {
     using namespace milvus;
@@ -116,6 +124,37 @@ TEST(Util, GetDeleteBitmap) {
     ASSERT_EQ(res_bitmap->bitmap_ptr->count(), 0);
 }
 
+TEST(Util, DeletedBitmapCache) {
+    using namespace milvus::segcore;
+    DeletedRecord delete_record;
+    auto insert = [&](int64_t barrier) {
+        auto entry = std::make_shared<DeletedRecord::TmpBitmap>();
+        entry->del_barrier = barrier;
+        entry->bitmap_ptr = std::make_shared<milvus::BitsetType>(barrier);
+        delete_record.insert_lru_entry(entry);
+    };
+    auto lookup = [&](int64_t barrier) {
+        int64_t old_del_barrier = 0;
+        bool hit_cache = false;
+        delete_record.clone_lru_entry(
+            barrier, barrier, old_del_barrier, hit_cache);
+        return hit_cache;
+    };
+
+    for (int64_t barrier = 1; barrier <= 4; ++barrier) {
+        insert(barrier);
+    }
+    // a hit keeps the oldest insert from being the next one evicted
+    ASSERT_TRUE(lookup(1));
+    insert(5);
+    ASSERT_TRUE(lookup(1));
+    ASSERT_FALSE(lookup(2));
+    for (int64_t barrier = 3; barrier <= 5; ++barrier) {
+        ASSERT_TRUE(lookup(barrier));
+    }
+    ASSERT_EQ(delete_record.get_lru_entry()->del_barrier, 5);
+}
+
 TEST(Util, OutOfRange) {
     using milvus::query::out_of_range;
 
@@ -196,23 +235,6 @@ TEST(Util, read_from_fd) {
         milvus::SegcoreError);
 }
 
-TEST(Util, get_common_prefix) {
-    std::string str1 = "";
-    std::string str2 = "milvus";
-    auto common_prefix = milvus::GetCommonPrefix(str1, str2);
-    EXPECT_STREQ(common_prefix.c_str(), "");
-
-    str1 = "milvus";
-    str2 = "milvus is great";
-    common_prefix = milvus::GetCommonPrefix(str1, str2);
-    EXPECT_STREQ(common_prefix.c_str(), "milvus");
-
-    str1 = "milvus";
-    str2 = "";
-    common_prefix = milvus::GetCommonPrefix(str1, str2);
-    EXPECT_STREQ(common_prefix.c_str(), "");
-}
-
 TEST(Util, dis_closer) {
     EXPECT_TRUE(milvus::query::dis_closer(0.1, 0.2, "L2"));
     EXPECT_FALSE(milvus::query::dis_closer(0.2, 0.1, "L2"));
@@ -222,3 +244,208 @@ TEST(Util, dis_closer) {
     EXPECT_FALSE(milvus::query::dis_closer(0.1, 0.2, "IP"));
     EXPECT_FALSE(milvus::query::dis_closer(0.1, 0.1, "IP"));
 }
+
+TEST(Util, LoadFieldDatasFromRemote) {
+    using namespace milvus;
+    auto storage_config = get_default_local_storage_config();
+    auto cm = storage::CreateChunkManager(storage_config);
+    auto prefix = storage_config.root_path + "/test_load_field_datas/";
+
+    // more binlogs than the pool runs at once, each larger than the budget
+    int64_t num_files = 16;
+    int64_t rows_per_file = 1000;
+    std::vector<std::string> files;
+    for (int64_t i = 0; i < num_files; ++i) {
+        std::vector<int64_t> data(rows_per_file);
+        std::iota(data.begin(), data.end(), i * rows_per_file);
+        auto field_data =
+            std::make_shared<FieldData<int64_t>>(DataType::INT64, false);
+        field_data->FillFieldData(data.data(), data.size());
+        storage::InsertData insert_data(field_data);
+        insert_data.SetFieldDataMeta({1, 2, 3, 101});
+        auto serialized = insert_data.serialize_to_remote_file();
+        files.push_back(prefix + std::to_string(i));
+        cm->Write(files.back(), serialized.data(), serialized.size());
+    }
+
+    for (int64_t budget : {int64_t(1), rows_per_file * 4 * 8, INT64_MAX}) {
+        auto channel = std::make_shared<FieldDataChannel>();
+        channel->set_capacity(1);
+        std::thread loader(
+            segcore::LoadFieldDatasFromRemote, files, channel, budget);
+        auto collected = storage::CollectFieldDataChannel(channel);
+        loader.join();
+        ASSERT_EQ(collected.size(), num_files);
+        int64_t expected = 0;
+        for (auto& field_data : collected) {
+            ASSERT_EQ(field_data->get_num_rows(), rows_per_file);
+            auto rows = static_cast<const int64_t*>(field_data->Data());
+            for (int64_t i = 0; i < rows_per_file; ++i) {
+                ASSERT_EQ(rows[i], expected++);
+            }
+        }
+    }
+
+    // a missing binlog fails the load once the files before it are consumed
+    auto broken = files;
+    broken.insert(broken.begin() + num_files / 2, prefix + "missing");
+    auto channel = std::make_shared<FieldDataChannel>();
+    std::thread loader(
+        segcore::LoadFieldDatasFromRemote, broken, channel, INT64_MAX);
+    ASSERT_ANY_THROW(storage::CollectFieldDataChannel(channel));
+    loader.join();
+
+    for (auto& file : files) {
+        cm->Remove(file);
+    }
+}
+
+TEST(Util, LoadFieldDatasFromRemoteInPlace) {
+    using namespace milvus;
+    auto storage_config = get_default_local_storage_config();
+    auto cm = storage::CreateChunkManager(storage_config);
+    auto prefix = storage_config.root_path + "/test_load_in_place_datas/";
+
+    int64_t num_files = 16;
+    int64_t rows_per_file = 1000;
+    std::vector<std::string> files;
+    std::vector<int64_t> entries_nums(num_files, rows_per_file);
+    for (int64_t i = 0; i < num_files; ++i) {
+        std::vector<int64_t> data(rows_per_file);
+        std::iota(data.begin(), data.end(), i * rows_per_file);
+        auto field_data =
+            std::make_shared<FieldData<int64_t>>(DataType::INT64, false);
+        field_data->FillFieldData(data.data(), data.size());
+        storage::InsertData insert_data(field_data);
+        insert_data.SetFieldDataMeta({1, 2, 3, 101});
+        auto serialized = insert_data.serialize_to_remote_file();
+        files.push_back(prefix + std::to_string(i));
+        cm->Write(files.back(), serialized.data(), serialized.size());
+    }
+
+    auto inflight =
+        monitor::internal_storage_load_inflight_bytes_field_data.Value();
+    for (int64_t budget : {int64_t(1), rows_per_file * 4 * 8, INT64_MAX}) {
+        std::vector<int64_t> rows(num_files * rows_per_file);
+        segcore::LoadFieldDatasFromRemoteInPlace(
+            files,
+            entries_nums,
+            storage::PayloadDecodeTarget{reinterpret_cast<char*>(rows.data()),
+                                         nullptr,
+                                         sizeof(int64_t),
+                                         num_files * rows_per_file},
+            budget);
+        for (int64_t i = 0; i < num_files * rows_per_file; ++i) {
+            ASSERT_EQ(rows[i], i);
+        }
+        // every reserved byte is released once the load returns
+        ASSERT_EQ(
+            monitor::internal_storage_load_inflight_bytes_field_data.Value(),
+            inflight);
+    }
+
+    // a missing binlog fails the load after the fetches in flight are done
+    auto broken = files;
+    broken.insert(broken.begin() + num_files / 2, prefix + "missing");
+    auto broken_entries_nums = entries_nums;
+    broken_entries_nums.push_back(rows_per_file);
+    std::vector<int64_t> rows((num_files + 1) * rows_per_file);
+    ASSERT_ANY_THROW(segcore::LoadFieldDatasFromRemoteInPlace(
+        broken,
+        broken_entries_nums,
+        storage::PayloadDecodeTarget{reinterpret_cast<char*>(rows.data()),
+                                     nullptr,
+                                     sizeof(int64_t),
+                                     (num_files + 1) * rows_per_file},
+        INT64_MAX));
+    ASSERT_EQ(monitor::internal_storage_load_inflight_bytes_field_data.Value(),
+              inflight);
+
+    for (auto& file : files) {
+        cm->Remove(file);
+    }
+}
+
+TEST(Util, LoadFieldDatasFromRemoteInPlaceSharedBudget) {
+    using namespace milvus;
+    auto storage_config = get_default_local_storage_config();
+    auto cm = storage::CreateChunkManager(storage_config);
+    auto prefix = storage_config.root_path + "/test_load_in_place_budget/";
+
+    // several fields load at once like a multi-field sealed load, each with
+    // its share of a budget of a few binlogs
+    int64_t num_fields = 4;
+    int64_t num_files = 16;
+    int64_t rows_per_file = 1000;
+    std::vector<std::vector<std::string>> files(num_fields);
+    std::vector<int64_t> entries_nums(num_files, rows_per_file);
+    int64_t max_file_size = 0;
+    for (int64_t field = 0; field < num_fields; ++field) {
+        for (int64_t i = 0; i < num_files; ++i) {
+            std::vector<int64_t> data(rows_per_file);
+            std::iota(data.begin(), data.end(), i * rows_per_file);
+            auto field_data =
+                std::make_shared<FieldData<int64_t>>(DataType::INT64, false);
+            field_data->FillFieldData(data.data(), data.size());
+            storage::InsertData insert_data(field_data);
+            insert_data.SetFieldDataMeta({1, 2, 3, 101 + field});
+            auto serialized = insert_data.serialize_to_remote_file();
+            files[field].push_back(prefix + std::to_string(field) + "/" +
+                                   std::to_string(i));
+            cm->Write(
+                files[field].back(), serialized.data(), serialized.size());
+            max_file_size = std::max<int64_t>(max_file_size, serialized.size());
+        }
+    }
+
+    auto budget = rows_per_file * int64_t(sizeof(int64_t)) * 2 * num_fields;
+    auto field_budget = budget / num_fields;
+    auto inflight =
+        monitor::internal_storage_load_inflight_bytes_field_data.Value();
+    std::atomic<bool> done{false};
+    double peak = 0;
+    std::thread sampler([&]() {
+        while (!done.load()) {
+            auto current =
+                monitor::internal_storage_load_inflight_bytes_field_data
+                    .Value();
+            peak = std::max(peak, current - inflight);
+        }
+    });
+
+    std::vector<std::vector<int64_t>> rows(num_fields);
+    std::vector<std::thread> loaders;
+    for (int64_t field = 0; field < num_fields; ++field) {
+        rows[field].resize(num_files * rows_per_file);
+        loaders.emplace_back([&, field]() {
+            segcore::LoadFieldDatasFromRemoteInPlace(
+                files[field],
+                entries_nums,
+                storage::PayloadDecodeTarget{
+                    reinterpret_cast<char*>(rows[field].data()),
+                    nullptr,
+                    sizeof(int64_t),
+                    num_files * rows_per_file},
+                field_budget);
+        });
+    }
+    for (auto& loader : loaders) {
+        loader.join();
+    }
+    done = true;
+    sampler.join();
+
+    // a field goes over its share by at most the binlog it always admits
+    ASSERT_LE(peak, num_fields * (field_budget + max_file_size));
+    for (int64_t field = 0; field < num_fields; ++field) {
+        for (int64_t i = 0; i < num_files * rows_per_file; ++i) {
+            ASSERT_EQ(rows[field][i], i);
+        }
+    }
+
+    for (auto& field_files : files) {
+        for (auto& file : field_files) {
+            cm->Remove(file);
+        }
+    }
+}
@@ -199,6 +199,18 @@ func (node *QueryNode) InitSegcore() error {
 	nprobe := C.int64_t(paramtable.Get().QueryNodeCfg.InterimIndexNProbe.GetAsInt64())
 	C.SegcoreSetNprobe(nprobe)
 
+	growingSearchParallelism := C.int64_t(paramtable.Get().QueryNodeCfg.GrowingSearchParallelism.GetAsInt64())
+	C.SegcoreSetGrowingSearchParallelism(growingSearchParallelism)
+
+	reduceParallelism := C.int64_t(paramtable.Get().QueryNodeCfg.ReduceParallelism.GetAsInt64())
+	C.SegcoreSetReduceParallelism(reduceParallelism)
+
+	groupByParallelism := C.int64_t(paramtable.Get().QueryNodeCfg.GroupByParallelism.GetAsInt64())
+	C.SegcoreSetGroupByParallelism(groupByParallelism)
+
+	enableVarcharPkHashIndex := C.bool(paramtable.Get().QueryNodeCfg.EnableVarcharPkHashIndex.GetAsBool())
+	C.SegcoreSetEnableVarcharPkHashIndex(enableVarcharPkHashIndex)
+
 	// override segcore SIMD type
 	cSimdType := C.CString(paramtable.Get().CommonCfg.SimdType.GetValue())
 	C.SegcoreSetSimdType(cSimdType)
@@ -235,6 +247,12 @@ func (node *QueryNode) InitSegcore() error {
 	cExprBatchSize := C.int64_t(paramtable.Get().QueryNodeCfg.ExprEvalBatchSize.GetAsInt64())
 	C.InitDefaultExprEvalBatchSize(cExprBatchSize)
 
+	cExprMaxDrivers := C.int64_t(paramtable.Get().QueryNodeCfg.ExprEvalMaxDrivers.GetAsInt64())
+	C.InitDefaultExprEvalMaxDrivers(cExprMaxDrivers)
+
+	cExprResultCacheSize := C.int64_t(paramtable.Get().QueryNodeCfg.ExprResultCacheSize.GetAsInt64() * 1024 * 1024)
+	C.InitDefaultExprResultCacheSize(cExprResultCacheSize)
+
 	cGpuMemoryPoolInitSize := C.uint32_t(paramtable.Get().GpuConfig.InitSize.GetAsUint32())
 	cGpuMemoryPoolMaxSize := C.uint32_t(paramtable.Get().GpuConfig.MaxSize.GetAsUint32())
 	C.SegcoreSetKnowhereGpuMemoryPoolSize(cGpuMemoryPoolInitSize, cGpuMemoryPoolMaxSize)
@@ -176,12 +176,17 @@ func InitMmapManager(params *paramtable.ComponentParam) error {
 	cMmapChunkManagerDir := C.CString(path.Join(mmapDirPath, "/mmap_chunk_manager/"))
 	cCacheReadAheadPolicy := C.CString(params.QueryNodeCfg.ReadAheadPolicy.GetValue())
 	defer C.free(unsafe.Pointer(cMmapChunkManagerDir))
+	cCacheEvictionPolicy := C.CString(params.QueryNodeCfg.ChunkCacheEvictionPolicy.GetValue())
 	defer C.free(unsafe.Pointer(cCacheReadAheadPolicy))
+	defer C.free(unsafe.Pointer(cCacheEvictionPolicy))
 	diskCapacity := params.QueryNodeCfg.DiskCapacityLimit.GetAsUint64()
 	diskLimit := uint64(float64(params.QueryNodeCfg.MaxMmapDiskPercentageForMmapManager.GetAsUint64()*diskCapacity) * 0.01)
 	mmapFileSize := params.QueryNodeCfg.FixedFileSizeForMmapManager.GetAsFloat() * 1024 * 1024
+	cacheCapacity := params.QueryNodeCfg.ChunkCacheCapacity.GetAsUint64() * 1024 * 1024
 	mmapConfig := C.CMmapConfig{
 		cache_read_ahead_policy: cCacheReadAheadPolicy,
+		cache_capacity:          C.uint64_t(cacheCapacity),
+		cache_eviction_policy:   cCacheEvictionPolicy,
 		mmap_path:               cMmapChunkManagerDir,
 		disk_limit:              C.uint64_t(diskLimit),
 		fix_file_size:           C.uint64_t(mmapFileSize),
@@ -2325,6 +2325,10 @@ type queryNodeConfig struct {
 	InterimIndexNProbe            ParamItem `refreshable:"false"`
 	InterimIndexMemExpandRate     ParamItem `refreshable:"false"`
 	InterimIndexBuildParallelRate ParamItem `refreshable:"false"`
+	GrowingSearchParallelism      ParamItem `refreshable:"false"`
+	ReduceParallelism             ParamItem `refreshable:"false"`
+	GroupByParallelism            ParamItem `refreshable:"false"`
+	EnableVarcharPkHashIndex      ParamItem `refreshable:"false"`
 
 	KnowhereScoreConsistency ParamItem `refreshable:"false"`
 
@@ -2359,8 +2363,10 @@ type queryNodeConfig struct {
 	LazyLoadMaxEvictPerRetry             ParamItem `refreshable:"true"`
 
 	// chunk cache
-	ReadAheadPolicy     ParamItem `refreshable:"false"`
-	ChunkCacheWarmingUp ParamItem `refreshable:"true"`
+	ReadAheadPolicy          ParamItem `refreshable:"false"`
+	ChunkCacheWarmingUp      ParamItem `refreshable:"true"`
+	ChunkCacheCapacity       ParamItem `refreshable:"false"`
+	ChunkCacheEvictionPolicy ParamItem `refreshable:"false"`
 
 	GroupEnabled          ParamItem `refreshable:"true"`
 	MaxReceiveChanSize    ParamItem `refreshable:"false"`
@@ -2397,7 +2403,9 @@ type queryNodeConfig struct {
 
 	EnableWorkerSQCostMetrics ParamItem `refreshable:"true"`
 
-	ExprEvalBatchSize ParamItem `refreshable:"false"`
+	ExprEvalBatchSize   ParamItem `refreshable:"false"`
+	ExprEvalMaxDrivers  ParamItem `refreshable:"false"`
+	ExprResultCacheSize ParamItem `refreshable:"false"`
 
 	// pipeline
 	CleanExcludeSegInterval ParamItem `refreshable:"false"`
@@ -2551,6 +2559,42 @@ This defaults to true, indicating that Milvus creates temporary index for growin
 	}
 	p.InterimIndexNProbe.Init(base.mgr)
 
+	p.GrowingSearchParallelism = ParamItem{
+		Key:          "queryNode.segcore.growingSearchParallelism",
+		Version:      "2.5.0",
+		DefaultValue: "4",
+		Doc:          "max number of tasks a single brute-force search on a growing segment is split into",
+		Export:       true,
+	}
+	p.GrowingSearchParallelism.Init(base.mgr)
+
+	p.ReduceParallelism = ParamItem{
+		Key:          "queryNode.segcore.reduceParallelism",
+		Version:      "2.5.0",
+		DefaultValue: "4",
+		Doc:          "max number of tasks reducing and marshaling the search results of one request is split into",
+		Export:       true,
+	}
+	p.ReduceParallelism.Init(base.mgr)
+
+	p.GroupByParallelism = ParamItem{
+		Key:          "queryNode.segcore.groupByParallelism",
+		Version:      "2.5.0",
+		DefaultValue: "4",
+		Doc:          "max number of tasks grouping the queries of one group-by search on a segment is split into",
+		Export:       true,
+	}
+	p.GroupByParallelism.Init(base.mgr)
+
+	p.EnableVarcharPkHashIndex = ParamItem{
+		Key:          "queryNode.segcore.enableVarcharPkHashIndex",
+		Version:      "2.5.0",
+		DefaultValue: "false",
+		Doc:          "build a pk to offset hash index on sorted sealed segments with varchar pk, trades memory for faster delete lookups",
+		Export:       true,
+	}
+	p.EnableVarcharPkHashIndex.Init(base.mgr)
+
 	p.LoadMemoryUsageFactor = ParamItem{
 		Key:          "queryNode.loadMemoryUsageFactor",
 		Version:      "2.0.0",
@@ -2773,6 +2817,24 @@ for a specific duration post-load, albeit accompanied by a concurrent increase i
 	}
 	p.ChunkCacheWarmingUp.Init(base.mgr)
 
+	p.ChunkCacheCapacity = ParamItem{
+		Key:          "queryNode.cache.capacity",
+		Version:      "2.5.0",
+		DefaultValue: "0",
+		Doc:          "The capacity(MB) of chunk cache, unpinned columns are evicted once exceeded, 0 means unlimited",
+		Export:       true,
+	}
+	p.ChunkCacheCapacity.Init(base.mgr)
+
+	p.ChunkCacheEvictionPolicy = ParamItem{
+		Key:          "queryNode.cache.evictionPolicy",
+		Version:      "2.5.0",
+		DefaultValue: "lru",
+		Doc:          "The eviction policy of chunk cache, options: `lru, clock`",
+		Export:       true,
+	}
+	p.ChunkCacheEvictionPolicy.Init(base.mgr)
+
 	p.GroupEnabled = ParamItem{
 		Key:          "queryNode.grouping.enabled",
 		Version:      "2.0.0",
@@ -3048,6 +3110,22 @@ user-task-polling:
 	}
 	p.ExprEvalBatchSize.Init(base.mgr)
 
+	p.ExprEvalMaxDrivers = ParamItem{
+		Key:          "queryNode.segcore.exprEvalMaxDrivers",
+		Version:      "2.5.0",
+		DefaultValue: "4",
+		Doc:          "max drivers a filter on one sealed segment is split into, 1 means sequential evaluation",
+	}
+	p.ExprEvalMaxDrivers.Init(base.mgr)
+
+	p.ExprResultCacheSize = ParamItem{
+		Key:          "queryNode.segcore.exprResultCacheSize",
+		Version:      "2.5.0",
+		DefaultValue: "0",
+		Doc:          "memory budget in MB shared by the filter result caches of all sealed segments on the query node, 0 disables the cache",
+	}
+	p.ExprResultCacheSize.Init(base.mgr)
+
 	p.CleanExcludeSegInterval = ParamItem{
 		Key:          "queryCoord.cleanExcludeSegmentInterval",
 		Version:      "2.4.0",
@@ -376,6 +376,13 @@ func TestComponentParam(t *testing.T) {
 		nprobe := Params.InterimIndexNProbe.GetAsInt64()
 		assert.Equal(t, int64(16), nprobe)
 
+		assert.Equal(t, int64(4), Params.GrowingSearchParallelism.GetAsInt64())
+		assert.Equal(t, int64(4), Params.ReduceParallelism.GetAsInt64())
+		assert.Equal(t, int64(4), Params.GroupByParallelism.GetAsInt64())
+		assert.Equal(t, false, Params.EnableVarcharPkHashIndex.GetAsBool())
+		assert.Equal(t, int64(4), Params.ExprEvalMaxDrivers.GetAsInt64())
+		assert.Equal(t, int64(0), Params.ExprResultCacheSize.GetAsInt64())
+
 		assert.Equal(t, true, Params.GroupEnabled.GetAsBool())
 		assert.Equal(t, int32(10240), Params.MaxReceiveChanSize.GetAsInt32())
 		assert.Equal(t, int32(10240), Params.MaxUnsolvedQueueSize.GetAsInt32())
@@ -384,6 +391,8 @@ func TestComponentParam(t *testing.T) {
 
 		// chunk cache
 		assert.Equal(t, "willneed", Params.ReadAheadPolicy.GetValue())
+		assert.Equal(t, int64(0), Params.ChunkCacheCapacity.GetAsInt64())
+		assert.Equal(t, "lru", Params.ChunkCacheEvictionPolicy.GetValue())
 		assert.Equal(t, "disable", Params.ChunkCacheWarmingUp.GetValue())
 
 		// test small indexNlist/NProbe default